@@ -20,11 +20,6 @@ typedef enum {
     ANIM_STATE_ATTACKING
 } AnimState;
 
-typedef struct {
-    SDL_Texture* walk[4][ANIM_WALK_FRAMES];
-    SDL_Texture* attack[4];
-} SpriteSet;
-
 typedef struct {
     AnimDirection direction;
     AnimState     state;
@@ -40,10 +35,5 @@ void Animation_setState(AnimationState* anim, AnimState state);
 void Animation_startWalk(AnimationState* anim, AnimDirection dir);
 void Animation_startAttack(AnimationState* anim);
 void Animation_stop(AnimationState* anim);
-SDL_Texture* Animation_getCurrentTexture(const AnimationState* anim, const SpriteSet* sprites);
-
-void SpriteSet_loadLink(SpriteSet* sprites, SDL_Renderer* renderer);
-void SpriteSet_loadEnemy(SpriteSet* sprites, SDL_Renderer* renderer);
-void SpriteSet_destroy(SpriteSet* sprites);
 
 #endif
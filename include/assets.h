@@ -3,8 +3,36 @@
 
 #include "core.h"
 
-bool assets_init(void);
+#define ASSET_PACK_FILE         "assets.pak"
+#define ASSET_PACK_MAGIC        "NPAK"
+#define ASSET_PACK_VERSION      1
+#define ASSET_PACK_HEADER_SIZE  16
+#define ASSET_PACK_PATH_SIZE    120
+#define ASSET_PACK_ENTRY_SIZE   (ASSET_PACK_PATH_SIZE + 24)
+#define ASSET_PACK_ALIGNMENT    16
+#define ASSET_LOOSE_ENV         "NUPRC_LOOSE_ASSETS"
+
+typedef struct {
+    const unsigned char* data;
+    size_t               size;
+    void*                owned;
+} AssetData;
+
+bool assets_init(const char* basePath);
+bool assets_initFromExecutable(const char* executablePath);
 const char* asset_full(const char* relPath);
 const char* assets_root(void);
 
+bool assets_openArchive(const char* archivePath);
+void assets_closeArchive(void);
+bool assets_hasArchive(void);
+
+bool asset_find(const char* relPath, const void** data, size_t* size);
+long asset_size(const char* relPath);
+bool asset_load(const char* relPath, AssetData* asset);
+void asset_release(AssetData* asset);
+bool asset_readLine(const AssetData* asset, size_t* cursor, char* line, size_t lineSize);
+
+uint32_t asset_checksum(const void* data, size_t size);
+
 #endif
@@ -1,7 +1,7 @@
 #ifndef NUPRC_AUDIO_H
 #define NUPRC_AUDIO_H
 
-#include "core.h"
+#include "render.h"
 
 typedef enum {
     AUDIO_SFX_ENEMY_KILLED,
@@ -21,6 +21,8 @@ typedef enum {
     AUDIO_MUSIC_COUNT
 } AudioMusicTrack;
 
+bool Audio_open(const char* configPath);
+void Audio_queueLoads(void);
 bool Audio_init(const char* configPath);
 void Audio_shutdown(void);
 void Audio_playSfx(AudioSfxEvent event);
@@ -13,16 +13,17 @@ typedef struct {
     CharacterType type;
     float         posX;
     float         posY;
+    float         prevX;
+    float         prevY;
     int           lives;
-    SDL_Texture*  texture;
     Map*          map;
 } Character;
 
 void Character_init(Character* c, CharacterType type, int lives, Map* map);
 void Character_moveSmooth(Character* c, float deltaX, float deltaY);
 void Character_move(Character* c, const int delta[2]);
-void Character_draw(const Character* c, SDL_Renderer* renderer);
-void Character_destroy(Character* c);
 void Character_getGridPos(const Character* c, int gridPos[2]);
+void Character_savePosition(Character* c);
+void Character_getRenderPos(const Character* c, float alpha, float renderPos[2]);
 
 #endif
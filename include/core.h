@@ -1,13 +1,10 @@
 #ifndef NUPRC_CORE_H
 #define NUPRC_CORE_H
 
-#include <SDL2/SDL.h>
-#include <SDL2/SDL_ttf.h>
-#include <SDL2/SDL_mixer.h>
-
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdbool.h>
+#include <stdint.h>
 #include <string.h>
 
 #define GRID_CELL_SIZE      50
@@ -33,14 +30,19 @@
 #define GAME_INITIAL_SCORE  0
 #define GAME_INITIAL_ROOM   {7, 7}
 #define GAME_WIN_KILLS      25
+#define GAME_TICK_RATE      60
+#define GAME_MAX_FRAME_TICKS 5
 
 #define MOVEMENT_SPEED      0.15f
 
 #define ASSET_TEXTURE_LINK      "textures/characters/link2.bmp"
 #define ASSET_TEXTURE_ENEMY     "textures/characters/enemy7.bmp"
+#define ASSET_ATLAS_CHARACTERS  "textures/atlas/characters.bmp"
+#define ASSET_ATLAS_FRAMES      "textures/atlas/characters.atlas"
 #define ASSET_MAP_TILES         "textures/map/overworldtiles.bmp"
 #define ASSET_MAP_WORLD         "meta/map/overworld_tile_map.txt"
 #define ASSET_MAP_BLOCKING      "meta/map/overworld_blocking_map.txt"
+#define ASSET_MAP_BINARY        "meta/map/overworld.nmap"
 #define ASSET_AUDIO_CONFIG      "meta/audio/audio.cfg"
 
 typedef enum {
@@ -48,15 +50,10 @@ typedef enum {
     STATE_PLAYING,
     STATE_PAUSED,
     STATE_GAMEOVER,
-    STATE_WIN
+    STATE_WIN,
+    STATE_LOADING
 } GameState;
 
-typedef struct {
-    SDL_Window*   window;
-    SDL_Renderer* renderer;
-    TTF_Font*     font;
-} RenderState;
-
 typedef struct {
     int score;
     int kills;
@@ -69,6 +66,8 @@ typedef struct {
     float y;
     float targetX;
     float targetY;
+    float prevX;
+    float prevY;
 } Camera;
 
 #endif
@@ -26,7 +26,6 @@ typedef struct {
     int             targetPos[2];
     bool            isActive;
     int             hitTimer;
-    SpriteSet       sprites;
     AnimationState  animation;
 } Enemy;
 
@@ -35,7 +34,6 @@ void Enemy_update(Enemy* e, const int playerPos[2], const Enemy* all, int count,
 bool Enemy_collidesWith(const Enemy* e, const int pos[2]);
 bool Enemy_isPositionOccupied(const int pos[2], const Enemy* all, int count, int exclude);
 bool Enemy_takeDamage(Enemy* e, int damage);
-void Enemy_draw(const Enemy* e, SDL_Renderer* renderer);
-void Enemy_destroy(Enemy* e);
+int Enemy_getMaxLives(const Enemy* e);
 
 #endif
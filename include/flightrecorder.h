@@ -0,0 +1,21 @@
+#ifndef NUPRC_FLIGHTRECORDER_H
+#define NUPRC_FLIGHTRECORDER_H
+
+#include "profiler.h"
+
+#define FLIGHT_HISTORY_SECONDS      2
+#define FLIGHT_MAX_FRAME_RATE       240
+#define FLIGHT_HISTORY              (FLIGHT_HISTORY_SECONDS * FLIGHT_MAX_FRAME_RATE)
+#define FLIGHT_HISTORY_NS           ((uint64_t)FLIGHT_HISTORY_SECONDS * 1000000000u)
+#define FLIGHT_MAX_ASSETS           8
+#define FLIGHT_ASSET_NAME_SIZE      64
+#define FLIGHT_MAX_REPORTS          16
+#define FLIGHT_DEFAULT_THRESHOLD_MS 50.0f
+
+void FlightRecorder_setThreshold(float thresholdMs);
+void FlightRecorder_setReportPrefix(const char* reportPrefix);
+void FlightRecorder_noteAsset(const char* name, uint64_t durationNs);
+void FlightRecorder_setEntityCount(int count);
+void FlightRecorder_endFrame(const float zoneMs[PROFILE_ZONE_COUNT], float frameMs);
+
+#endif
@@ -0,0 +1,36 @@
+#ifndef NUPRC_FRAMEBUFFER_H
+#define NUPRC_FRAMEBUFFER_H
+
+#include "core.h"
+
+#define FRAMEBUFFER_MAX_REPLICATE   8
+
+typedef enum {
+    FRAMEBUFFER_SIMD_SCALAR,
+    FRAMEBUFFER_SIMD_SSE2,
+    FRAMEBUFFER_SIMD_AVX2,
+    FRAMEBUFFER_SIMD_COUNT
+} FramebufferSimd;
+
+typedef struct {
+    uint32_t* pixels;
+    int       width;
+    int       height;
+    int       stride;
+} Framebuffer;
+
+FramebufferSimd Framebuffer_detectSimd(void);
+bool Framebuffer_isSupported(FramebufferSimd level);
+bool Framebuffer_setSimd(FramebufferSimd level);
+FramebufferSimd Framebuffer_getSimd(void);
+const char* Framebuffer_simdName(FramebufferSimd level);
+bool Framebuffer_parseSimd(const char* name, FramebufferSimd* level);
+void Framebuffer_shutdown(void);
+
+void Framebuffer_blitScaled(const Framebuffer* src, Framebuffer* dst, int x, int y, int w, int h);
+void Framebuffer_blitKeyed(const Framebuffer* src, Framebuffer* dst, int x, int y, int w, int h, uint32_t tint);
+void Framebuffer_blitBlend(const Framebuffer* src, Framebuffer* dst, int x, int y, int w, int h, uint32_t tint);
+void Framebuffer_fillRect(Framebuffer* dst, int x, int y, int w, int h, uint32_t color);
+void Framebuffer_blendRect(Framebuffer* dst, int x, int y, int w, int h, uint32_t color);
+
+#endif
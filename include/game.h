@@ -1,23 +1,36 @@
 #ifndef NUPRC_GAME_H
 #define NUPRC_GAME_H
 
-#include "core.h"
-#include "map.h"
-#include "link.h"
-#include "enemy.h"
+#include "render.h"
+#include "world.h"
+#include "scene.h"
 #include "menu.h"
+#include "replay.h"
+
+typedef enum {
+    REPLAY_MODE_OFF,
+    REPLAY_MODE_RECORD,
+    REPLAY_MODE_PLAYBACK
+} ReplayMode;
 
 typedef struct {
     RenderState render;
     GameState   state;
     GameState   previousState;
-    PlayerStats stats;
-    Map         map;
-    Link        player;
-    Enemy       enemies[GAME_MAX_ENEMIES];
-    int         enemyCount;
+    World       world;
+    Scene       scene;
     bool        running;
     Menu        menu;
+    ReplayMode  replayMode;
+    const char* replayPath;
+    Replay      replay;
+    InputState  tickInput;
+    bool        showDebug;
+    int         fps;
+    uint64_t    loadStartNs;
+    int         frameLimit;
+    int         frameCount;
+    const char* screenshotPath;
 } Game;
 
 void Game_init(Game* game);
@@ -31,6 +44,6 @@ void Game_resume(Game* game);
 
 void Game_handleInput(Game* game);
 void Game_update(Game* game);
-void Game_render(Game* game);
+void Game_render(Game* game, float alpha);
 
 #endif
@@ -1,7 +1,9 @@
 #ifndef NUPRC_HUD_H
 #define NUPRC_HUD_H
 
-#include "core.h"
+#include "render.h"
+#include "profiler.h"
+#include "renderstats.h"
 
 #define HUD_HEIGHT              WINDOW_TEXTAREA_HEIGHT
 #define HUD_LINE_SPACING        25
@@ -11,6 +13,21 @@
 #define HUD_COLUMN_2_X          180
 #define HUD_COLUMN_3_X          360
 #define HUD_CONTROLS_X          550
+#define HUD_FIELD_TEXT_SIZE     64
+
+#define HUD_DEBUG_X             8
+#define HUD_DEBUG_Y             8
+#define HUD_DEBUG_WIDTH         (HUD_DEBUG_GRAPH_WIDTH + 2 * HUD_MARGIN_LEFT)
+#define HUD_DEBUG_LINE_SPACING  18
+#define HUD_DEBUG_VALUES_X      110
+#define HUD_DEBUG_VALUE_WIDTH   65
+#define HUD_DEBUG_STATS_X       80
+#define HUD_DEBUG_STATS_WIDTH   46
+#define HUD_DEBUG_GRAPH_WIDTH   PROFILER_HISTORY
+#define HUD_DEBUG_GRAPH_HEIGHT  60
+
+#define HUD_LOADING_BAR_WIDTH   400
+#define HUD_LOADING_BAR_HEIGHT  20
 
 #define HUD_BG_COLOR_R          40
 #define HUD_BG_COLOR_G          40
@@ -33,7 +50,9 @@ typedef struct {
 void HUD_render(const RenderState* render, const PlayerStats* stats, int lives, const int currentRoom[2]);
 void HUD_initConfig(HUDConfig* config);
 void HUD_renderWithConfig(const RenderState* render, const PlayerStats* stats, int lives, const int currentRoom[2], const HUDConfig* config);
+void HUD_shutdown(void);
 void HUD_renderDebugInfo(const RenderState* render, int fps, int entityCount);
+void HUD_renderLoading(const RenderState* render, int completed, int total);
 void HUD_showMessage(const RenderState* render, const char* message, int duration);
 void HUD_renderHealthBar(const RenderState* render, int x, int y, int currentLives, int maxLives, int width, int height);
 
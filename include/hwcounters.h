@@ -0,0 +1,26 @@
+#ifndef NUPRC_HWCOUNTERS_H
+#define NUPRC_HWCOUNTERS_H
+
+#include "profiler.h"
+
+typedef enum {
+    HW_COUNTER_CYCLES,
+    HW_COUNTER_INSTRUCTIONS,
+    HW_COUNTER_L1D_MISSES,
+    HW_COUNTER_LLC_MISSES,
+    HW_COUNTER_BRANCH_MISSES,
+    HW_COUNTER_COUNT
+} HwCounter;
+
+bool HwCounters_init(void);
+void HwCounters_shutdown(void);
+bool HwCounters_isActive(void);
+bool HwCounters_isAvailable(HwCounter counter);
+
+void HwCounters_zoneBegin(ProfileZone zone);
+void HwCounters_zoneEnd(ProfileZone zone);
+
+void HwCounters_getZoneTotals(ProfileZone zone, uint64_t values[HW_COUNTER_COUNT], long* calls);
+void HwCounters_printReport(FILE* out);
+
+#endif
@@ -25,6 +25,7 @@ typedef struct {
     bool moveRight;
     bool attack;
     bool interact;
+    bool toggleDebug;
 } InputState;
 
 InputAction inputPoll(void);
@@ -8,6 +8,7 @@
 #define LINK_ATTACK_ACTIVE_TIME 15
 #define LINK_INVINCIBILITY_TIME 90
 #define LINK_ATTACK_RANGE       1
+#define LINK_ATTACK_ZONE_SIZE   3
 
 typedef enum {
     LINK_DIR_UP,
@@ -23,7 +24,6 @@ typedef struct {
     int             attackCooldown;
     int             invincibilityTimer;
     bool            isInvincible;
-    SpriteSet       sprites;
     AnimationState  animation;
 } Link;
 
@@ -32,10 +32,9 @@ void Link_update(Link* link);
 void Link_attack(Link* link);
 void Link_takeDamage(Link* link, int damage);
 void Link_getAttackPosition(const Link* link, int attackPos[2]);
+void Link_getAttackZone(const Link* link, int attackZone[LINK_ATTACK_ZONE_SIZE][2]);
 bool Link_isAttacking(const Link* link);
 void Link_move(Link* link, const int delta[2]);
 void Link_moveSmooth(Link* link, float deltaX, float deltaY);
-void Link_draw(const Link* link, SDL_Renderer* renderer);
-void Link_destroy(Link* link);
 
 #endif
@@ -0,0 +1,22 @@
+#ifndef NUPRC_LOADER_H
+#define NUPRC_LOADER_H
+
+#include "render.h"
+
+#define LOADER_MAX_JOBS     64
+#define LOADER_MAX_WORKERS  8
+#define LOADER_PATH_SIZE    128
+
+void Loader_queueImage(const char* path);
+void Loader_queueSound(const char* path);
+void Loader_start(void);
+void Loader_shutdown(void);
+
+int  Loader_completed(void);
+int  Loader_total(void);
+bool Loader_isDone(void);
+
+SDL_Surface* Loader_takeSurface(const char* path);
+Mix_Chunk*   Loader_takeChunk(const char* path);
+
+#endif
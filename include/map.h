@@ -3,6 +3,13 @@
 
 #include "core.h"
 
+#define MAP_FILE_MAGIC          "NMAP"
+#define MAP_FILE_VERSION        1
+#define MAP_FILE_HEADER_SIZE    16
+#define MAP_SECTION_HEADER_SIZE 8
+#define MAP_SECTION_TILES       "TILE"
+#define MAP_SECTION_BLOCKING    "BLCK"
+
 typedef struct {
     bool isBlocking;
     char textureId;
@@ -15,23 +22,21 @@ typedef struct {
 } Room;
 
 typedef struct {
-    SDL_Renderer* renderer;
     int currentRoom[2];
     Room rooms[GRID_WORLD_HEIGHT / GRID_ROOM_HEIGHT][GRID_WORLD_WIDTH / GRID_ROOM_WIDTH];
     Tile world[GRID_WORLD_HEIGHT][GRID_WORLD_WIDTH];
-    SDL_Texture** textures;
     Camera camera;
 } Map;
 
-void Map_init(Map* map, SDL_Renderer* renderer);
-void Map_draw(const Map* map, bool drawGrid);
-void Map_destroy(Map* map);
+void Map_init(Map* map);
 bool Map_isBlocking(const Map* map, const int pos[2]);
 Room* Map_getRoom(Map* map, const int pos[2]);
 
 void Camera_init(Camera* cam);
 void Camera_followF(Camera* cam, float playerX, float playerY);
 void Camera_follow(Camera* cam, const int playerPos[2]);
+void Camera_savePosition(Camera* cam);
+void Camera_interpolate(const Camera* cam, float alpha, Camera* out);
 void Camera_worldToScreenF(const Camera* cam, float worldX, float worldY, int screenPos[2]);
 void Camera_worldToScreen(const Camera* cam, const int worldPos[2], int screenPos[2]);
 
@@ -39,4 +44,7 @@ void Room_getCenter(const Room* room, int center[2]);
 bool Room_isInside(const Room* room, const int pos[2]);
 void Room_handleTransition(Map* map, const int charPos[2]);
 
+void loadWorldMap(const char* path, int map[GRID_WORLD_HEIGHT][GRID_WORLD_WIDTH]);
+void loadBlockingMap(const char* path, char map[GRID_WORLD_HEIGHT][GRID_WORLD_WIDTH]);
+
 #endif
@@ -1,7 +1,7 @@
 #ifndef NUPRC_MENU_H
 #define NUPRC_MENU_H
 
-#include "core.h"
+#include "render.h"
 
 #define MENU_MAX_OPTIONS    6
 #define MENU_BUTTON_WIDTH   200
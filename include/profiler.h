@@ -0,0 +1,41 @@
+#ifndef NUPRC_PROFILER_H
+#define NUPRC_PROFILER_H
+
+#include "core.h"
+
+#define PROFILER_HISTORY        300
+#define PROFILER_FRAME_BUDGET_MS (1000.0f / GAME_TICK_RATE)
+
+typedef enum {
+    PROFILE_ZONE_INPUT,
+    PROFILE_ZONE_UPDATE,
+    PROFILE_ZONE_AI,
+    PROFILE_ZONE_COLLISION,
+    PROFILE_ZONE_SPAWN,
+    PROFILE_ZONE_MAP,
+    PROFILE_ZONE_ENTITIES,
+    PROFILE_ZONE_HUD,
+    PROFILE_ZONE_PRESENT,
+    PROFILE_ZONE_COUNT
+} ProfileZone;
+
+typedef struct {
+    float minMs;
+    float avgMs;
+    float p99Ms;
+    float maxMs;
+} ProfileStats;
+
+void Profiler_beginFrame(void);
+void Profiler_endFrame(void);
+void Profiler_begin(ProfileZone zone);
+void Profiler_end(ProfileZone zone);
+
+const char* Profiler_zoneName(ProfileZone zone);
+int  Profiler_frameCount(void);
+void Profiler_getZoneStats(ProfileZone zone, ProfileStats* stats);
+void Profiler_getFrameStats(ProfileStats* stats);
+int  Profiler_getFrameHistory(float* frameMs, int maxFrames);
+float Profiler_lastZoneMs(ProfileZone zone);
+
+#endif
@@ -3,19 +3,76 @@
 
 #include "core.h"
 
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_ttf.h>
+#include <SDL2/SDL_mixer.h>
+
+#define TEXTURE_CACHE_CAPACITY  128
+#define TEXTURE_CACHE_PATH_SIZE 128
+#define TEXTURE_HANDLE_NONE     0
+#define TEXTURE_SHADOW_CAPACITY 256
+
+#define WORLD_NATIVE_WIDTH      (GRID_ROOM_WIDTH * MAP_TILE_SIZE)
+#define WORLD_NATIVE_HEIGHT     (GRID_ROOM_HEIGHT * MAP_TILE_SIZE)
+#define WORLD_NATIVE_SCALE      ((float)MAP_TILE_SIZE / GRID_CELL_SIZE)
+
+typedef int TextureHandle;
+
+typedef enum {
+    RENDER_SCALE_NEAREST,
+    RENDER_SCALE_INTEGER
+} RenderScaleMode;
+
+typedef enum {
+    RENDER_BACKEND_GPU,
+    RENDER_BACKEND_SOFTWARE
+} RenderBackend;
+
+typedef struct {
+    SDL_Window*     window;
+    SDL_Renderer*   renderer;
+    TTF_Font*       font;
+    SDL_Texture*    world;
+    RenderScaleMode scaleMode;
+    bool            worldDirect;
+    RenderBackend   backend;
+    SDL_Surface*    framebuffer;
+} RenderState;
+
 void initSDL(void);
 SDL_Window* createWindow(const char* name, int w, int h);
 SDL_Renderer* createRenderer(SDL_Window* window);
+SDL_Renderer* createSoftwareRenderer(RenderState* render);
 void quitSDL(SDL_Window* window, SDL_Renderer* renderer);
+void destroyFramebuffer(RenderState* render);
 
-void updateDisplay(SDL_Renderer* renderer);
+void updateDisplay(const RenderState* render);
+bool saveScreenshot(const RenderState* render, const char* path);
+void setScaleMode(RenderState* render, RenderScaleMode mode);
+bool beginWorldPass(RenderState* render);
+void endWorldPass(RenderState* render);
+void destroyWorldTarget(RenderState* render);
 void clearRenderer(SDL_Renderer* renderer);
+SDL_RWops* openAssetRW(const char* path);
 SDL_Texture* loadTexture(const char* path, SDL_Renderer* renderer);
 void renderTexture(SDL_Texture* tex, SDL_Renderer* r, int x, int y, int w, int h);
 
-SDL_Texture** loadTileTextures(const char* path, SDL_Renderer* renderer);
-void loadWorldMap(const char* path, int map[GRID_WORLD_HEIGHT][GRID_WORLD_WIDTH]);
-void loadBlockingMap(const char* path, char map[GRID_WORLD_HEIGHT][GRID_WORLD_WIDTH]);
+int renderCopy(SDL_Renderer* r, SDL_Texture* tex, const SDL_Rect* src, const SDL_Rect* dst);
+int renderFillRect(SDL_Renderer* r, const SDL_Rect* rect);
+int renderDrawRect(SDL_Renderer* r, const SDL_Rect* rect);
+int renderDrawLine(SDL_Renderer* r, int x1, int y1, int x2, int y2);
+int renderGeometry(SDL_Renderer* r, SDL_Texture* tex, const SDL_Vertex* vertices, int vertexCount,
+                   const int* indices, int indexCount, long pixels);
+int renderSetColorMod(SDL_Texture* tex, Uint8 red, Uint8 green, Uint8 blue);
+int renderUpdateTexture(SDL_Texture* tex, const SDL_Rect* rect, const void* pixels, int pitch);
+SDL_Texture* renderCreateTexture(SDL_Renderer* r, SDL_Surface* surface);
+SDL_Texture* renderCreateTargetTexture(SDL_Renderer* r, int w, int h);
+void renderDestroyTexture(SDL_Texture* tex);
+
+TextureHandle textureCacheAcquire(const char* path, SDL_Renderer* renderer);
+SDL_Texture* textureCacheGet(TextureHandle handle);
+void textureCacheRelease(TextureHandle handle);
+int textureCacheCount(void);
 
 void printText(int x, int y, const char* text, int w, int h, SDL_Renderer* r);
 void printTextWithFont(int x, int y, const char* text, TTF_Font* font, SDL_Renderer* r);
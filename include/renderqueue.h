@@ -0,0 +1,36 @@
+#ifndef NUPRC_RENDERQUEUE_H
+#define NUPRC_RENDERQUEUE_H
+
+#include "render.h"
+#include "renderstats.h"
+
+#define RENDER_QUEUE_MIN_CAPACITY   256
+
+typedef enum {
+    RENDER_LAYER_EFFECTS,
+    RENDER_LAYER_ENTITIES,
+    RENDER_LAYER_ENTITY_UI,
+    RENDER_LAYER_OVERLAY,
+    RENDER_LAYER_COUNT
+} RenderLayer;
+
+typedef struct {
+    SDL_Texture*  texture;
+    SDL_Rect      source;
+    SDL_Rect      dst;
+    SDL_Color     color;
+    SDL_BlendMode blend;
+    RenderLayer   layer;
+    RenderPass    pass;
+    int           sequence;
+} RenderCommand;
+
+void RenderQueue_begin(SDL_Renderer* renderer);
+void RenderQueue_sprite(RenderLayer layer, SDL_Texture* texture, const SDL_Rect* source,
+                        const SDL_Rect* dst, SDL_Color tint);
+void RenderQueue_fillRect(RenderLayer layer, const SDL_Rect* rect, SDL_Color color, SDL_BlendMode blend);
+void RenderQueue_drawRect(RenderLayer layer, const SDL_Rect* rect, SDL_Color color, SDL_BlendMode blend);
+void RenderQueue_flush(void);
+void RenderQueue_shutdown(void);
+
+#endif
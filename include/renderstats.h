@@ -0,0 +1,39 @@
+#ifndef NUPRC_RENDERSTATS_H
+#define NUPRC_RENDERSTATS_H
+
+#include "core.h"
+
+typedef enum {
+    RENDER_PASS_MAP,
+    RENDER_PASS_ENTITIES,
+    RENDER_PASS_HUD,
+    RENDER_PASS_MENU,
+    RENDER_PASS_DEBUG,
+    RENDER_PASS_COUNT
+} RenderPass;
+
+typedef struct {
+    int  drawCalls;
+    int  textureBinds;
+    int  colorMods;
+    int  texturesCreated;
+    int  texturesDestroyed;
+    long pixelsFilled;
+} RenderCounters;
+
+void RenderStats_beginFrame(void);
+void RenderStats_endFrame(void);
+void RenderStats_setPass(RenderPass pass);
+RenderPass RenderStats_getPass(void);
+
+void RenderStats_countDraw(long pixels);
+void RenderStats_countBind(const void* texture);
+void RenderStats_countColorMod(void);
+void RenderStats_countTextureCreated(void);
+void RenderStats_countTextureDestroyed(void);
+
+const char* RenderStats_passName(RenderPass pass);
+const RenderCounters* RenderStats_getLastFrame(RenderPass pass);
+void RenderStats_getLastFrameTotal(RenderCounters* total);
+
+#endif
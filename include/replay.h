@@ -0,0 +1,38 @@
+#ifndef NUPRC_REPLAY_H
+#define NUPRC_REPLAY_H
+
+#include "core.h"
+#include "iomanager.h"
+
+#define REPLAY_MAGIC        "NRPL"
+#define REPLAY_VERSION      1
+
+typedef enum {
+    REPLAY_INPUT_UP       = 1 << 0,
+    REPLAY_INPUT_DOWN     = 1 << 1,
+    REPLAY_INPUT_LEFT     = 1 << 2,
+    REPLAY_INPUT_RIGHT    = 1 << 3,
+    REPLAY_INPUT_ATTACK   = 1 << 4,
+    REPLAY_INPUT_INTERACT = 1 << 5
+} ReplayInputBit;
+
+typedef struct {
+    uint32_t  seed;
+    uint8_t*  inputs;
+    uint32_t* hashes;
+    int       count;
+    int       capacity;
+    int       cursor;
+} Replay;
+
+void Replay_init(Replay* replay, uint32_t seed);
+void Replay_free(Replay* replay);
+bool Replay_record(Replay* replay, const InputState* input, uint32_t hash);
+bool Replay_next(Replay* replay, InputState* input, uint32_t* expectedHash);
+bool Replay_save(const Replay* replay, const char* path);
+bool Replay_load(Replay* replay, const char* path);
+
+uint8_t Replay_packInput(const InputState* input);
+void Replay_unpackInput(uint8_t bits, InputState* input);
+
+#endif
@@ -0,0 +1,47 @@
+#ifndef NUPRC_SCENE_H
+#define NUPRC_SCENE_H
+
+#include "render.h"
+#include "sprites.h"
+#include "map.h"
+#include "link.h"
+#include "enemy.h"
+
+#define SCENE_VISIBLE_COLS       (WINDOW_WIDTH / GRID_CELL_SIZE + 2)
+#define SCENE_VISIBLE_ROWS       ((WINDOW_HEIGHT - WINDOW_TEXTAREA_HEIGHT) / GRID_CELL_SIZE + 2)
+#define SCENE_MAX_VISIBLE_TILES  (SCENE_VISIBLE_COLS * SCENE_VISIBLE_ROWS)
+#define SCENE_ROOM_CACHE_SIZE    9
+#define SCENE_ROOM_PIXEL_WIDTH   (GRID_ROOM_WIDTH * GRID_CELL_SIZE)
+#define SCENE_ROOM_PIXEL_HEIGHT  (GRID_ROOM_HEIGHT * GRID_CELL_SIZE)
+#define SCENE_ROOM_NATIVE_WIDTH  (GRID_ROOM_WIDTH * MAP_TILE_SIZE)
+#define SCENE_ROOM_NATIVE_HEIGHT (GRID_ROOM_HEIGHT * MAP_TILE_SIZE)
+
+typedef struct {
+    SDL_Texture* texture;
+    int          room[2];
+    uint64_t     lastUsed;
+} RoomTexture;
+
+typedef struct {
+    SDL_Renderer* renderer;
+    TextureHandle tileAtlas;
+    int           tileAtlasSize[2];
+    SDL_Vertex*   tileVertices;
+    int*          tileIndices;
+    RoomTexture   roomCache[SCENE_ROOM_CACHE_SIZE];
+    uint64_t      roomFrame;
+    bool          roomTargets;
+    bool          roomCacheLost;
+    SpriteSet     linkSprites;
+    SpriteSet     enemySprites;
+} Scene;
+
+void Scene_queueAssets(void);
+void Scene_init(Scene* scene, SDL_Renderer* renderer);
+void Scene_destroy(Scene* scene);
+
+void Scene_drawMap(Scene* scene, const Map* map, bool drawGrid, float alpha);
+void Scene_drawEnemy(const Scene* scene, const Enemy* enemy, const Camera* view, float alpha);
+void Scene_drawLink(const Scene* scene, const Link* link, const Camera* view, float alpha);
+
+#endif
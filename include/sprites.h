@@ -0,0 +1,26 @@
+#ifndef NUPRC_SPRITES_H
+#define NUPRC_SPRITES_H
+
+#include "render.h"
+#include "animation.h"
+
+#define SPRITE_ATLAS_MAX_FRAMES 64
+
+typedef struct {
+    TextureHandle texture;
+    SDL_Rect      source;
+} SpriteFrame;
+
+typedef struct {
+    SpriteFrame walk[4][ANIM_WALK_FRAMES];
+    SpriteFrame attack[4];
+} SpriteSet;
+
+const SpriteFrame* Animation_getCurrentFrame(const AnimationState* anim, const SpriteSet* sprites);
+
+void SpriteSet_queueAssets(void);
+void SpriteSet_loadLink(SpriteSet* sprites, SDL_Renderer* renderer);
+void SpriteSet_loadEnemy(SpriteSet* sprites, SDL_Renderer* renderer);
+void SpriteSet_destroy(SpriteSet* sprites);
+
+#endif
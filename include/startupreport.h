@@ -0,0 +1,21 @@
+#ifndef NUPRC_STARTUPREPORT_H
+#define NUPRC_STARTUPREPORT_H
+
+#include "core.h"
+
+#define STARTUP_MAX_STEPS       32
+#define STARTUP_MAX_ASSETS      64
+#define STARTUP_NAME_SIZE       64
+
+void StartupReport_enable(void);
+bool StartupReport_isEnabled(void);
+
+void StartupReport_step(const char* name, uint64_t startNs);
+void StartupReport_addDecode(const char* asset, long bytes, uint64_t durationNs);
+void StartupReport_addUpload(const char* asset, uint64_t durationNs);
+
+void StartupReport_markReady(void);
+void StartupReport_markFrame(void);
+void StartupReport_print(FILE* out);
+
+#endif
@@ -0,0 +1,21 @@
+#ifndef NUPRC_TEXT_H
+#define NUPRC_TEXT_H
+
+#include "render.h"
+
+#define TEXT_MAX_FONTS      4
+#define TEXT_FIRST_GLYPH    32
+#define TEXT_LAST_GLYPH     255
+#define TEXT_GLYPH_COUNT    (TEXT_LAST_GLYPH - TEXT_FIRST_GLYPH + 1)
+#define TEXT_KERNING_LAST   126
+#define TEXT_KERNING_COUNT  (TEXT_KERNING_LAST - TEXT_FIRST_GLYPH + 1)
+#define TEXT_ATLAS_WIDTH    512
+#define TEXT_MAX_QUADS      256
+
+bool Text_prepare(TTF_Font* font, SDL_Renderer* renderer);
+void Text_shutdown(void);
+
+void Text_size(TTF_Font* font, const char* text, int* width, int* height);
+void Text_draw(SDL_Renderer* renderer, TTF_Font* font, int x, int y, const char* text, SDL_Color color);
+
+#endif
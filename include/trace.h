@@ -0,0 +1,18 @@
+#ifndef NUPRC_TRACE_H
+#define NUPRC_TRACE_H
+
+#include "core.h"
+
+#define TRACE_CHUNK_EVENTS  4096
+#define TRACE_DETAIL_SIZE   96
+
+bool Trace_start(const char* path);
+void Trace_stop(void);
+bool Trace_isEnabled(void);
+
+void Trace_begin(const char* name, const char* category);
+void Trace_beginDetail(const char* name, const char* category, const char* detail);
+void Trace_end(const char* name, const char* category);
+void Trace_instant(const char* name, const char* category, const char* detail);
+
+#endif
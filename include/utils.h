@@ -8,5 +8,10 @@ void screenToWorld(const int screen[2], int world[2], const int room[2]);
 int manhattanDistance(const int a[2], const int b[2]);
 bool positionsEqual(const int a[2], const int b[2]);
 void copyPosition(const int src[2], int dest[2]);
+uint64_t timeNowNs(void);
+
+void randomSeed(uint32_t seed);
+int randomInt(int bound);
+uint32_t randomState(void);
 
 #endif
@@ -0,0 +1,21 @@
+#ifndef NUPRC_VISIBILITY_H
+#define NUPRC_VISIBILITY_H
+
+#include "core.h"
+#include "enemy.h"
+
+#define VISIBILITY_MARGIN_CELLS 1.0f
+
+typedef struct {
+    float left;
+    float top;
+    float right;
+    float bottom;
+} ViewRect;
+
+void ViewRect_fromCamera(const Camera* view, ViewRect* rect);
+bool ViewRect_contains(const ViewRect* rect, float cellX, float cellY);
+
+int Visibility_collectEnemies(const ViewRect* rect, const Enemy* enemies, int count, float alpha, int* visible);
+
+#endif
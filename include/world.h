@@ -0,0 +1,41 @@
+#ifndef NUPRC_WORLD_H
+#define NUPRC_WORLD_H
+
+#include "core.h"
+#include "map.h"
+#include "link.h"
+#include "enemy.h"
+#include "iomanager.h"
+
+typedef enum {
+    WORLD_EVENT_ATTACK       = 1 << 0,
+    WORLD_EVENT_ENEMY_KILLED = 1 << 1,
+    WORLD_EVENT_PLAYER_HIT   = 1 << 2
+} WorldEvent;
+
+typedef enum {
+    WORLD_OUTCOME_RUNNING,
+    WORLD_OUTCOME_DEFEAT,
+    WORLD_OUTCOME_VICTORY
+} WorldOutcome;
+
+typedef struct {
+    PlayerStats stats;
+    Map         map;
+    Link        player;
+    Enemy       enemies[GAME_MAX_ENEMIES];
+    int         enemyCount;
+    unsigned    events;
+    bool        playerMoving;
+} World;
+
+void World_init(World* world, unsigned seed);
+void World_beginTick(World* world);
+void World_applyInput(World* world, const InputState* input);
+WorldOutcome World_update(World* world);
+unsigned World_takeEvents(World* world);
+int World_countActiveEnemies(const World* world);
+uint32_t World_hash(const World* world);
+void World_randomPositionNearPlayer(const Map* map, const int playerPos[2], int outPos[2]);
+
+#endif
@@ -1,9 +1,38 @@
 #include "assets.h"
 
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+typedef struct {
+    const unsigned char* base;
+    size_t               size;
+    uint32_t             count;
+#ifdef _WIN32
+    HANDLE               file;
+    HANDLE               mapping;
+#endif
+} AssetArchive;
+
 static char g_assetsRoot[1024] = {0};
 static bool g_assetsReady = false;
-static char g_pathBuffers[16][1024];
-static int g_pathBufferIndex = 0;
+static _Thread_local char g_pathBuffers[16][1024];
+static _Thread_local int g_pathBufferIndex = 0;
+static AssetArchive g_archive = {0};
+
+static uint32_t readU32(const unsigned char* in) {
+    return (uint32_t)in[0] | ((uint32_t)in[1] << 8) |
+           ((uint32_t)in[2] << 16) | ((uint32_t)in[3] << 24);
+}
+
+static uint64_t readU64(const unsigned char* in) {
+    return (uint64_t)readU32(in) | ((uint64_t)readU32(in + 4) << 32);
+}
 
 static bool isAbsolutePath(const char* path) {
     if (!path || path[0] == '\0') return false;
@@ -22,27 +51,49 @@ static const char* skipAssetsPrefix(const char* path) {
     return path;
 }
 
-bool assets_init(void) {
+bool assets_init(const char* basePath) {
     if (g_assetsReady) return true;
-
-    const char* base = SDL_GetBasePath();
-    if (!base) {
-        fprintf(stderr, "Impossible de recuperer SDL_GetBasePath: %s\n", SDL_GetError());
-        return false;
-    }
+    if (!basePath) return false;
 
     const char* suffix = "assets/";
-    snprintf(g_assetsRoot, sizeof(g_assetsRoot), "%s%s", base, suffix);
-    SDL_free((void*)base);
+    snprintf(g_assetsRoot, sizeof(g_assetsRoot), "%s%s", basePath, suffix);
     g_assetsReady = true;
+
+    const char* loose = getenv(ASSET_LOOSE_ENV);
+    if (!loose || loose[0] == '\0' || strcmp(loose, "0") == 0) {
+        char archivePath[1024];
+        snprintf(archivePath, sizeof(archivePath), "%s%s", basePath, ASSET_PACK_FILE);
+        assets_openArchive(archivePath);
+    }
     return true;
 }
 
+bool assets_initFromExecutable(const char* executablePath) {
+    char basePath[1024] = "";
+
+    if (executablePath) {
+        const char* lastSeparator = NULL;
+        for (const char* c = executablePath; *c != '\0'; c++) {
+            if (*c == '/' || *c == '\\') lastSeparator = c;
+        }
+
+        if (lastSeparator) {
+            const size_t length = (size_t)(lastSeparator - executablePath) + 1;
+            if (length < sizeof(basePath)) {
+                memcpy(basePath, executablePath, length);
+                basePath[length] = '\0';
+            }
+        }
+    }
+
+    return assets_init(basePath);
+}
+
 const char* asset_full(const char* relPath) {
     if (!relPath || relPath[0] == '\0') return relPath;
     if (isAbsolutePath(relPath)) return relPath;
 
-    if (!g_assetsReady && !assets_init()) {
+    if (!g_assetsReady && !assets_init("")) {
         return relPath;
     }
 
@@ -53,6 +104,191 @@ const char* asset_full(const char* relPath) {
 }
 
 const char* assets_root(void) {
-    if (!g_assetsReady && !assets_init()) return "";
+    if (!g_assetsReady && !assets_init("")) return "";
     return g_assetsRoot;
 }
+
+static bool mapArchive(const char* archivePath) {
+#ifdef _WIN32
+    HANDLE file = CreateFileA(archivePath, GENERIC_READ, FILE_SHARE_READ, NULL,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE) return false;
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size) || size.QuadPart < ASSET_PACK_HEADER_SIZE) {
+        CloseHandle(file);
+        return false;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    const void* base = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : NULL;
+    if (!base) {
+        if (mapping) CloseHandle(mapping);
+        CloseHandle(file);
+        return false;
+    }
+
+    g_archive.file = file;
+    g_archive.mapping = mapping;
+    g_archive.base = base;
+    g_archive.size = (size_t)size.QuadPart;
+#else
+    const int fd = open(archivePath, O_RDONLY);
+    if (fd < 0) return false;
+
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size < ASSET_PACK_HEADER_SIZE) {
+        close(fd);
+        return false;
+    }
+
+    void* base = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED) return false;
+
+    g_archive.base = base;
+    g_archive.size = (size_t)info.st_size;
+#endif
+    return true;
+}
+
+static void unmapArchive(void) {
+#ifdef _WIN32
+    UnmapViewOfFile(g_archive.base);
+    CloseHandle(g_archive.mapping);
+    CloseHandle(g_archive.file);
+#else
+    munmap((void*)g_archive.base, g_archive.size);
+#endif
+    memset(&g_archive, 0, sizeof(g_archive));
+}
+
+bool assets_openArchive(const char* archivePath) {
+    assets_closeArchive();
+    if (!archivePath || !mapArchive(archivePath)) return false;
+
+    const unsigned char* header = g_archive.base;
+    const uint32_t count = readU32(header + 8);
+    const uint64_t indexEnd = ASSET_PACK_HEADER_SIZE + (uint64_t)count * ASSET_PACK_ENTRY_SIZE;
+
+    bool valid = memcmp(header, ASSET_PACK_MAGIC, 4) == 0 &&
+                 readU32(header + 4) == ASSET_PACK_VERSION &&
+                 indexEnd <= g_archive.size;
+
+    for (uint32_t i = 0; valid && i < count; i++) {
+        const unsigned char* entry = header + ASSET_PACK_HEADER_SIZE + (size_t)i * ASSET_PACK_ENTRY_SIZE;
+        const uint64_t offset = readU64(entry + ASSET_PACK_PATH_SIZE);
+        const uint64_t size = readU64(entry + ASSET_PACK_PATH_SIZE + 8);
+        valid = entry[ASSET_PACK_PATH_SIZE - 1] == '\0' &&
+                offset >= indexEnd && offset <= g_archive.size && size <= g_archive.size - offset;
+    }
+
+    if (!valid) {
+        fprintf(stderr, "Archive d'assets invalide : %s\n", archivePath);
+        unmapArchive();
+        return false;
+    }
+
+    g_archive.count = count;
+    return true;
+}
+
+void assets_closeArchive(void) {
+    if (g_archive.base) unmapArchive();
+}
+
+bool assets_hasArchive(void) {
+    return g_archive.base != NULL;
+}
+
+static int compareEntryPath(const void* key, const void* entry) {
+    return strncmp((const char*)key, (const char*)entry, ASSET_PACK_PATH_SIZE);
+}
+
+bool asset_find(const char* relPath, const void** data, size_t* size) {
+    if (!g_archive.base || !relPath) return false;
+
+    const char* normalizedRelPath = skipAssetsPrefix(relPath);
+    const unsigned char* entry = bsearch(normalizedRelPath, g_archive.base + ASSET_PACK_HEADER_SIZE,
+                                         g_archive.count, ASSET_PACK_ENTRY_SIZE, compareEntryPath);
+    if (!entry) return false;
+
+    *data = g_archive.base + readU64(entry + ASSET_PACK_PATH_SIZE);
+    *size = (size_t)readU64(entry + ASSET_PACK_PATH_SIZE + 8);
+    return true;
+}
+
+long asset_size(const char* relPath) {
+    const void* data;
+    size_t size;
+    if (asset_find(relPath, &data, &size)) return (long)size;
+
+    FILE* file = fopen(asset_full(relPath), "rb");
+    if (!file) return -1;
+
+    const long length = fseek(file, 0, SEEK_END) == 0 ? ftell(file) : -1;
+    fclose(file);
+    return length;
+}
+
+bool asset_load(const char* relPath, AssetData* asset) {
+    memset(asset, 0, sizeof(*asset));
+
+    const void* data;
+    size_t size;
+    if (asset_find(relPath, &data, &size)) {
+        asset->data = data;
+        asset->size = size;
+        return true;
+    }
+
+    FILE* file = fopen(asset_full(relPath), "rb");
+    if (!file) return false;
+
+    bool ok = fseek(file, 0, SEEK_END) == 0;
+    const long length = ok ? ftell(file) : -1;
+    ok = length >= 0 && fseek(file, 0, SEEK_SET) == 0;
+
+    unsigned char* buffer = ok ? malloc((size_t)length + 1) : NULL;
+    ok = buffer && fread(buffer, 1, (size_t)length, file) == (size_t)length;
+    fclose(file);
+
+    if (!ok) {
+        free(buffer);
+        return false;
+    }
+
+    buffer[length] = '\0';
+    asset->data = buffer;
+    asset->size = (size_t)length;
+    asset->owned = buffer;
+    return true;
+}
+
+void asset_release(AssetData* asset) {
+    free(asset->owned);
+    memset(asset, 0, sizeof(*asset));
+}
+
+bool asset_readLine(const AssetData* asset, size_t* cursor, char* line, size_t lineSize) {
+    if (*cursor >= asset->size || lineSize == 0) return false;
+
+    size_t length = 0;
+    while (*cursor < asset->size) {
+        const char c = (char)asset->data[(*cursor)++];
+        if (length + 1 < lineSize) line[length++] = c;
+        if (c == '\n') break;
+    }
+
+    line[length] = '\0';
+    return true;
+}
+
+uint32_t asset_checksum(const void* data, size_t size) {
+    const unsigned char* bytes = data;
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < size; i++) {
+        hash = (hash ^ bytes[i]) * 16777619u;
+    }
+    return hash;
+}
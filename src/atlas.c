@@ -0,0 +1,264 @@
+#include "core.h"
+
+#define ATLAS_WIDTH         128
+#define ATLAS_PADDING       1
+#define ATLAS_MAX_FRAMES    64
+#define BMP_FILE_HEADER     14
+#define BMP_V4_HEADER       108
+
+typedef struct {
+    const char* path;
+    int         width;
+    int         height;
+    uint32_t*   pixels;
+    int         x;
+    int         y;
+} AtlasFrame;
+
+static void usage(const char* program) {
+    fprintf(stderr, "Usage : %s SORTIE.bmp SORTIE.atlas RACINE FICHIER.bmp...\n", program);
+    fprintf(stderr, "  Regroupe les sprites dans un atlas BMP 32 bits et ecrit la table des frames\n");
+}
+
+static uint16_t readU16(const unsigned char* in) {
+    return (uint16_t)(in[0] | (in[1] << 8));
+}
+
+static uint32_t readU32(const unsigned char* in) {
+    return (uint32_t)in[0] | ((uint32_t)in[1] << 8) |
+           ((uint32_t)in[2] << 16) | ((uint32_t)in[3] << 24);
+}
+
+static void writeU16(unsigned char* out, uint16_t value) {
+    out[0] = (unsigned char)(value & 0xFFu);
+    out[1] = (unsigned char)(value >> 8);
+}
+
+static void writeU32(unsigned char* out, uint32_t value) {
+    for (int i = 0; i < 4; i++) {
+        out[i] = (unsigned char)((value >> (i * 8)) & 0xFFu);
+    }
+}
+
+static int maskShift(uint32_t mask) {
+    int shift = 0;
+    while (mask != 0 && (mask & 1u) == 0) {
+        mask >>= 1;
+        shift++;
+    }
+    return shift;
+}
+
+static uint32_t extractChannel(uint32_t value, uint32_t mask) {
+    if (mask == 0) return 0xFFu;
+    return ((value & mask) >> maskShift(mask)) & 0xFFu;
+}
+
+static bool decodeBMP(const unsigned char* data, size_t size, AtlasFrame* frame) {
+    if (size < BMP_FILE_HEADER + 40 || data[0] != 'B' || data[1] != 'M') return false;
+
+    const uint32_t pixelOffset = readU32(data + 10);
+    const uint32_t headerSize = readU32(data + 14);
+    const int32_t width = (int32_t)readU32(data + 18);
+    const int32_t rawHeight = (int32_t)readU32(data + 22);
+    const uint16_t bpp = readU16(data + 28);
+    const uint32_t compression = readU32(data + 30);
+
+    const bool topDown = rawHeight < 0;
+    const int height = topDown ? -rawHeight : rawHeight;
+    if (width <= 0 || height <= 0 || (bpp != 24 && bpp != 32)) return false;
+
+    uint32_t masks[4] = {0x00FF0000u, 0x0000FF00u, 0x000000FFu, 0};
+    if (compression == 3 && headerSize >= 56) {
+        for (int i = 0; i < 4; i++) masks[i] = readU32(data + BMP_FILE_HEADER + 40 + i * 4);
+    } else if (compression != 0) {
+        return false;
+    }
+
+    const size_t stride = (((size_t)width * bpp / 8) + 3) & ~(size_t)3;
+    if (pixelOffset > size || stride * (size_t)height > size - pixelOffset) return false;
+
+    frame->pixels = malloc((size_t)width * (size_t)height * sizeof(uint32_t));
+    if (!frame->pixels) return false;
+    frame->width = width;
+    frame->height = height;
+
+    for (int y = 0; y < height; y++) {
+        const int sourceRow = topDown ? y : height - 1 - y;
+        const unsigned char* row = data + pixelOffset + (size_t)sourceRow * stride;
+
+        for (int x = 0; x < width; x++) {
+            uint32_t r, g, b, a;
+            if (bpp == 24) {
+                b = row[x * 3];
+                g = row[x * 3 + 1];
+                r = row[x * 3 + 2];
+                a = 0xFFu;
+            } else {
+                const uint32_t value = readU32(row + x * 4);
+                r = extractChannel(value, masks[0]);
+                g = extractChannel(value, masks[1]);
+                b = extractChannel(value, masks[2]);
+                a = extractChannel(value, masks[3]);
+            }
+            frame->pixels[y * width + x] = (a << 24) | (r << 16) | (g << 8) | b;
+        }
+    }
+    return true;
+}
+
+static bool loadFrame(const char* root, const char* path, AtlasFrame* frame) {
+    char sourcePath[1024];
+    snprintf(sourcePath, sizeof(sourcePath), "%s/%s", root, path);
+
+    FILE* file = fopen(sourcePath, "rb");
+    if (!file) return false;
+
+    bool ok = fseek(file, 0, SEEK_END) == 0;
+    const long length = ok ? ftell(file) : -1;
+    ok = length > 0 && fseek(file, 0, SEEK_SET) == 0;
+
+    unsigned char* data = ok ? malloc((size_t)length) : NULL;
+    ok = data && fread(data, 1, (size_t)length, file) == (size_t)length;
+    fclose(file);
+
+    ok = ok && decodeBMP(data, (size_t)length, frame);
+    free(data);
+    frame->path = path;
+    return ok;
+}
+
+static int compareHeight(const void* a, const void* b) {
+    const AtlasFrame* frameA = *(const AtlasFrame* const*)a;
+    const AtlasFrame* frameB = *(const AtlasFrame* const*)b;
+    if (frameA->height != frameB->height) return frameB->height - frameA->height;
+    return strcmp(frameA->path, frameB->path);
+}
+
+static int packShelves(AtlasFrame* frames, int count) {
+    AtlasFrame* order[ATLAS_MAX_FRAMES];
+    for (int i = 0; i < count; i++) order[i] = &frames[i];
+    qsort(order, (size_t)count, sizeof(AtlasFrame*), compareHeight);
+
+    int x = ATLAS_PADDING;
+    int y = ATLAS_PADDING;
+    int shelfHeight = 0;
+
+    for (int i = 0; i < count; i++) {
+        AtlasFrame* frame = order[i];
+        if (frame->width + 2 * ATLAS_PADDING > ATLAS_WIDTH) return -1;
+
+        if (x + frame->width + ATLAS_PADDING > ATLAS_WIDTH) {
+            x = ATLAS_PADDING;
+            y += shelfHeight + ATLAS_PADDING;
+            shelfHeight = 0;
+        }
+
+        frame->x = x;
+        frame->y = y;
+        x += frame->width + ATLAS_PADDING;
+        if (frame->height > shelfHeight) shelfHeight = frame->height;
+    }
+
+    return y + shelfHeight + ATLAS_PADDING;
+}
+
+static bool writeAtlasImage(const char* path, const AtlasFrame* frames, int count, int height) {
+    const size_t pixelBytes = (size_t)ATLAS_WIDTH * (size_t)height * 4;
+    unsigned char* image = calloc(1, BMP_FILE_HEADER + BMP_V4_HEADER + pixelBytes);
+    if (!image) return false;
+
+    unsigned char* header = image;
+    header[0] = 'B';
+    header[1] = 'M';
+    writeU32(header + 2, (uint32_t)(BMP_FILE_HEADER + BMP_V4_HEADER + pixelBytes));
+    writeU32(header + 10, BMP_FILE_HEADER + BMP_V4_HEADER);
+
+    unsigned char* info = image + BMP_FILE_HEADER;
+    writeU32(info, BMP_V4_HEADER);
+    writeU32(info + 4, ATLAS_WIDTH);
+    writeU32(info + 8, (uint32_t)height);
+    writeU16(info + 12, 1);
+    writeU16(info + 14, 32);
+    writeU32(info + 16, 3);
+    writeU32(info + 20, (uint32_t)pixelBytes);
+    writeU32(info + 40, 0x00FF0000u);
+    writeU32(info + 44, 0x0000FF00u);
+    writeU32(info + 48, 0x000000FFu);
+    writeU32(info + 52, 0xFF000000u);
+    memcpy(info + 56, "BGRs", 4);
+
+    unsigned char* pixels = info + BMP_V4_HEADER;
+    for (int i = 0; i < count; i++) {
+        const AtlasFrame* frame = &frames[i];
+        for (int y = 0; y < frame->height; y++) {
+            const int row = height - 1 - (frame->y + y);
+            for (int x = 0; x < frame->width; x++) {
+                writeU32(pixels + ((size_t)row * ATLAS_WIDTH + (size_t)(frame->x + x)) * 4,
+                         frame->pixels[y * frame->width + x]);
+            }
+        }
+    }
+
+    FILE* file = fopen(path, "wb");
+    bool ok = file != NULL;
+    if (ok) {
+        const size_t total = BMP_FILE_HEADER + BMP_V4_HEADER + pixelBytes;
+        ok = fwrite(image, 1, total, file) == total;
+        if (fclose(file) != 0) ok = false;
+    }
+
+    free(image);
+    return ok;
+}
+
+static bool writeFrameTable(const char* path, const AtlasFrame* frames, int count, int height) {
+    FILE* file = fopen(path, "w");
+    if (!file) return false;
+
+    fprintf(file, "# atlas %d %d\n", ATLAS_WIDTH, height);
+    for (int i = 0; i < count; i++) {
+        fprintf(file, "%s %d %d %d %d\n", frames[i].path,
+                frames[i].x, frames[i].y, frames[i].width, frames[i].height);
+    }
+    return fclose(file) == 0;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 5 || argc - 4 > ATLAS_MAX_FRAMES) {
+        usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    const int count = argc - 4;
+    static AtlasFrame frames[ATLAS_MAX_FRAMES];
+
+    bool ok = true;
+    for (int i = 0; i < count && ok; i++) {
+        ok = loadFrame(argv[3], argv[4 + i], &frames[i]);
+        if (!ok) fprintf(stderr, "Sprite illisible (BMP 24/32 bits attendu) : %s\n", argv[4 + i]);
+    }
+
+    const int height = ok ? packShelves(frames, count) : -1;
+    if (ok && height < 0) {
+        fprintf(stderr, "Sprite plus large que l'atlas (%d px)\n", ATLAS_WIDTH);
+        ok = false;
+    }
+
+    if (ok && !writeAtlasImage(argv[1], frames, count, height)) {
+        fprintf(stderr, "Impossible d'ecrire %s\n", argv[1]);
+        ok = false;
+    }
+    if (ok && !writeFrameTable(argv[2], frames, count, height)) {
+        fprintf(stderr, "Impossible d'ecrire %s\n", argv[2]);
+        ok = false;
+    }
+
+    for (int i = 0; i < count; i++) {
+        free(frames[i].pixels);
+    }
+
+    if (!ok) return EXIT_FAILURE;
+    printf("%s : %d sprites, %dx%d\n", argv[1], count, ATLAS_WIDTH, height);
+    return EXIT_SUCCESS;
+}
@@ -1,5 +1,10 @@
 #include "audio.h"
 #include "assets.h"
+#include "trace.h"
+#include "flightrecorder.h"
+#include "utils.h"
+#include "loader.h"
+#include "startupreport.h"
 
 #include <ctype.h>
 
@@ -21,6 +26,7 @@ typedef struct {
 } AudioConfig;
 
 typedef struct {
+    bool opened;
     bool initialized;
     AudioConfig config;
     Mix_Chunk* sfx[AUDIO_SFX_COUNT];
@@ -98,15 +104,16 @@ static void applyConfigEntry(AudioConfig* cfg, const char* key, const char* valu
 }
 
 static void loadConfigFile(AudioConfig* cfg, const char* path) {
-    const char* resolvedPath = asset_full(path);
-    FILE* file = fopen(resolvedPath, "r");
-    if (!file) {
-        fprintf(stderr, "Audio config introuvable: %s\n", resolvedPath);
+    const uint64_t start = timeNowNs();
+    AssetData file;
+    if (!asset_load(path, &file)) {
+        fprintf(stderr, "Audio config introuvable: %s\n", asset_full(path));
         return;
     }
 
     char line[1024];
-    while (fgets(line, sizeof(line), file)) {
+    size_t cursor = 0;
+    while (asset_readLine(&file, &cursor, line, sizeof(line))) {
         trim(line);
         if (line[0] == '\0' || line[0] == '#') continue;
 
@@ -121,25 +128,35 @@ static void loadConfigFile(AudioConfig* cfg, const char* path) {
         applyConfigEntry(cfg, key, value);
     }
 
-    fclose(file);
+    StartupReport_addDecode(path, (long)file.size, timeNowNs() - start);
+    asset_release(&file);
 }
 
 static Mix_Chunk* loadChunk(const char* path) {
     if (!path || path[0] == '\0') return NULL;
-    const char* resolvedPath = asset_full(path);
-    Mix_Chunk* chunk = Mix_LoadWAV(resolvedPath);
+    Mix_Chunk* chunk = Loader_takeChunk(path);
     if (!chunk) {
-        fprintf(stderr, "SFX non charge: %s (%s)\n", resolvedPath, Mix_GetError());
+        const uint64_t start = timeNowNs();
+        chunk = Mix_LoadWAV_RW(openAssetRW(path), 1);
+        if (StartupReport_isEnabled()) {
+            StartupReport_addDecode(path, asset_size(path), timeNowNs() - start);
+        }
+    }
+    if (!chunk) {
+        fprintf(stderr, "SFX non charge: %s (%s)\n", asset_full(path), Mix_GetError());
     }
     return chunk;
 }
 
 static Mix_Music* loadMusic(const char* path) {
     if (!path || path[0] == '\0') return NULL;
-    const char* resolvedPath = asset_full(path);
-    Mix_Music* music = Mix_LoadMUS(resolvedPath);
+    const uint64_t start = timeNowNs();
+    Mix_Music* music = Mix_LoadMUS_RW(openAssetRW(path), 1);
+    if (StartupReport_isEnabled()) {
+        StartupReport_addDecode(path, asset_size(path), timeNowNs() - start);
+    }
     if (!music) {
-        fprintf(stderr, "Music non chargee: %s (%s)\n", resolvedPath, Mix_GetError());
+        fprintf(stderr, "Music non chargee: %s (%s)\n", asset_full(path), Mix_GetError());
     }
     return music;
 }
@@ -154,8 +171,22 @@ static void applyVolumes(const AudioConfig* cfg) {
     Mix_Volume(-1, finalSfx);
 }
 
-bool Audio_init(const char* configPath) {
-    if (g_audio.initialized) return true;
+static const char* sfxPath(const AudioConfig* cfg, AudioSfxEvent event) {
+    switch (event) {
+        case AUDIO_SFX_ENEMY_KILLED: return cfg->sfxEnemyKilled;
+        case AUDIO_SFX_WALK:         return cfg->sfxWalk;
+        case AUDIO_SFX_MENU_CLICK:   return cfg->sfxMenuClick;
+        case AUDIO_SFX_MENU_MOVE:    return cfg->sfxMenuMove;
+        case AUDIO_SFX_ATTACK:       return cfg->sfxAttack;
+        case AUDIO_SFX_PLAYER_HIT:   return cfg->sfxPlayerHit;
+        case AUDIO_SFX_GAME_OVER:    return cfg->sfxGameOver;
+        case AUDIO_SFX_COUNT:        break;
+    }
+    return NULL;
+}
+
+bool Audio_open(const char* configPath) {
+    if (g_audio.opened) return true;
 
     if (SDL_WasInit(SDL_INIT_AUDIO) == 0 && SDL_InitSubSystem(SDL_INIT_AUDIO) < 0) {
         fprintf(stderr, "Audio init SDL echouee: %s\n", SDL_GetError());
@@ -176,14 +207,24 @@ bool Audio_init(const char* configPath) {
     g_audio.config.musicVolume = clampInt(g_audio.config.musicVolume, 0, 128);
     g_audio.config.sfxVolume = clampInt(g_audio.config.sfxVolume, 0, 128);
     g_audio.config.walkIntervalFrames = clampInt(g_audio.config.walkIntervalFrames, 1, 60);
+    g_audio.opened = true;
+    return true;
+}
 
-    g_audio.sfx[AUDIO_SFX_ENEMY_KILLED] = loadChunk(g_audio.config.sfxEnemyKilled);
-    g_audio.sfx[AUDIO_SFX_WALK] = loadChunk(g_audio.config.sfxWalk);
-    g_audio.sfx[AUDIO_SFX_MENU_CLICK] = loadChunk(g_audio.config.sfxMenuClick);
-    g_audio.sfx[AUDIO_SFX_MENU_MOVE] = loadChunk(g_audio.config.sfxMenuMove);
-    g_audio.sfx[AUDIO_SFX_ATTACK] = loadChunk(g_audio.config.sfxAttack);
-    g_audio.sfx[AUDIO_SFX_PLAYER_HIT] = loadChunk(g_audio.config.sfxPlayerHit);
-    g_audio.sfx[AUDIO_SFX_GAME_OVER] = loadChunk(g_audio.config.sfxGameOver);
+void Audio_queueLoads(void) {
+    if (!g_audio.opened) return;
+
+    for (int i = 0; i < AUDIO_SFX_COUNT; i++) {
+        Loader_queueSound(sfxPath(&g_audio.config, (AudioSfxEvent)i));
+    }
+}
+
+static bool initAudio(const char* configPath) {
+    if (!Audio_open(configPath)) return false;
+
+    for (int i = 0; i < AUDIO_SFX_COUNT; i++) {
+        g_audio.sfx[i] = loadChunk(sfxPath(&g_audio.config, (AudioSfxEvent)i));
+    }
 
     g_audio.music[AUDIO_MUSIC_MENU] = loadMusic(g_audio.config.musicMenu);
     g_audio.music[AUDIO_MUSIC_GAMEPLAY] = loadMusic(g_audio.config.musicGameplay);
@@ -197,8 +238,19 @@ bool Audio_init(const char* configPath) {
     return true;
 }
 
+bool Audio_init(const char* configPath) {
+    if (g_audio.initialized) return true;
+
+    Trace_beginDetail("Audio_init", "asset", configPath);
+    const uint64_t start = timeNowNs();
+    const bool ready = initAudio(configPath);
+    FlightRecorder_noteAsset(configPath, timeNowNs() - start);
+    Trace_end("Audio_init", "asset");
+    return ready;
+}
+
 void Audio_shutdown(void) {
-    if (!g_audio.initialized) return;
+    if (!g_audio.opened) return;
 
     Mix_HaltMusic();
 
@@ -217,6 +269,7 @@ void Audio_shutdown(void) {
 
     Mix_CloseAudio();
     Mix_Quit();
+    g_audio.opened = false;
     g_audio.initialized = false;
 }
 
@@ -0,0 +1,501 @@
+#include "world.h"
+#include "assets.h"
+#include "utils.h"
+#include "visibility.h"
+#include "framebuffer.h"
+
+#include <math.h>
+
+#ifdef NUPRC_BENCH_SDL
+#include "scene.h"
+#include "text.h"
+#endif
+
+#define BENCH_DEFAULT_SAMPLES   30
+#define BENCH_MAX_SAMPLES       1000
+#define BENCH_TARGET_SAMPLE_NS  2000000ull
+#define BENCH_MAX_ITERATIONS    (1 << 24)
+#define BENCH_MAX_ENEMIES       1000
+#define BENCH_TEXT_X            10
+#define BENCH_TEXT_Y            10
+#define BENCH_ENEMY_SEED        1
+#define BENCH_BLIT_WIDTH        (GRID_ROOM_WIDTH * MAP_TILE_SIZE)
+#define BENCH_BLIT_HEIGHT       (GRID_ROOM_HEIGHT * MAP_TILE_SIZE)
+#define BENCH_FRAME_HEIGHT      (WINDOW_HEIGHT - WINDOW_TEXTAREA_HEIGHT)
+#define BENCH_SIMD_NONE         -1
+#define BENCH_SPRITE_SIZE       64
+#define BENCH_SPRITE_X          100
+#define BENCH_SPRITE_Y          100
+#define BENCH_TEXT_TINT         0xFFFFFF00u
+#define BENCH_OVERLAY_COLOR     0xB4000000u
+
+typedef struct {
+    World  world;
+    Enemy  enemies[BENCH_MAX_ENEMIES];
+    Enemy  pristineEnemies[BENCH_MAX_ENEMIES];
+    int    enemyCount;
+    int    visible[BENCH_MAX_ENEMIES];
+    int    playerPos[2];
+    int    worldTiles[GRID_WORLD_HEIGHT][GRID_WORLD_WIDTH];
+    char   blockingTiles[GRID_WORLD_HEIGHT][GRID_WORLD_WIDTH];
+    uint32_t blitSource[BENCH_BLIT_WIDTH * BENCH_BLIT_HEIGHT];
+    uint32_t spriteSource[BENCH_SPRITE_SIZE * BENCH_SPRITE_SIZE];
+    uint32_t frame[WINDOW_WIDTH * WINDOW_HEIGHT];
+#ifdef NUPRC_BENCH_SDL
+    RenderState   render;
+    TTF_Font*     font;
+    Scene         scene;
+#endif
+} BenchState;
+
+typedef struct {
+    const char* name;
+    int         scale;
+    int         simd;
+    void      (*setup)(BenchState* state, int scale);
+    void      (*run)(BenchState* state, int scale, long iterations);
+    void      (*reset)(BenchState* state, int scale);
+} BenchCase;
+
+typedef struct {
+    double mean;
+    double stddev;
+    double min;
+    double p50;
+    double p90;
+    double p99;
+    double max;
+} BenchStats;
+
+typedef struct {
+    int         samples;
+    const char* filter;
+    const char* outputPath;
+} BenchOptions;
+
+static volatile int g_sink = 0;
+
+static int compareDoubles(const void* a, const void* b) {
+    const double da = *(const double*)a;
+    const double db = *(const double*)b;
+    return (da > db) - (da < db);
+}
+
+static double percentile(const double* sorted, int count, int pct) {
+    int index = (count * pct + 99) / 100 - 1;
+    if (index < 0) index = 0;
+    if (index >= count) index = count - 1;
+    return sorted[index];
+}
+
+static void computeStats(double* samples, int count, BenchStats* stats) {
+    double sum = 0.0;
+    for (int i = 0; i < count; i++) {
+        sum += samples[i];
+    }
+    stats->mean = sum / count;
+
+    double variance = 0.0;
+    for (int i = 0; i < count; i++) {
+        const double diff = samples[i] - stats->mean;
+        variance += diff * diff;
+    }
+    stats->stddev = count > 1 ? sqrt(variance / (count - 1)) : 0.0;
+
+    qsort(samples, (size_t)count, sizeof(double), compareDoubles);
+    stats->min = samples[0];
+    stats->p50 = percentile(samples, count, 50);
+    stats->p90 = percentile(samples, count, 90);
+    stats->p99 = percentile(samples, count, 99);
+    stats->max = samples[count - 1];
+}
+
+static void placeEnemies(BenchState* state, int count) {
+    randomSeed(BENCH_ENEMY_SEED);
+    state->enemyCount = count;
+
+    for (int i = 0; i < count; i++) {
+        int pos[2];
+        World_randomPositionNearPlayer(&state->world.map, state->playerPos, pos);
+        Enemy_init(&state->enemies[i], (EnemyType)(i % 3),
+                   i % 3 == 0 ? ENEMY_AI_RANDOM : ENEMY_AI_CHASE, &state->world.map, pos);
+    }
+}
+
+static void setupWorld(BenchState* state, int scale) {
+    (void)scale;
+    World_init(&state->world, 1);
+    Character_getGridPos(&state->world.player.base, state->playerPos);
+}
+
+static void setupEnemies(BenchState* state, int scale) {
+    setupWorld(state, scale);
+    placeEnemies(state, scale);
+    memcpy(state->pristineEnemies, state->enemies, (size_t)state->enemyCount * sizeof(Enemy));
+}
+
+static void resetEnemies(BenchState* state, int scale) {
+    (void)scale;
+    memcpy(state->enemies, state->pristineEnemies, (size_t)state->enemyCount * sizeof(Enemy));
+    randomSeed(BENCH_ENEMY_SEED);
+}
+
+static void runMoveSmooth(BenchState* state, int scale, long iterations) {
+    (void)scale;
+    Character* c = &state->world.player.base;
+    const float startX = (float)state->playerPos[0];
+    const float startY = (float)state->playerPos[1];
+
+    for (long i = 0; i < iterations; i++) {
+        const float direction = (i & 32) ? -MOVEMENT_SPEED : MOVEMENT_SPEED;
+        Character_moveSmooth(c, direction, direction);
+        if ((i & 63) == 63) {
+            c->posX = startX;
+            c->posY = startY;
+        }
+    }
+    g_sink += (int)c->posX;
+}
+
+static void runPositionOccupied(BenchState* state, int scale, long iterations) {
+    (void)scale;
+    int hits = 0;
+    for (long i = 0; i < iterations; i++) {
+        const int pos[2] = {
+            state->playerPos[0] + (int)(i % 21) - 10,
+            state->playerPos[1] + (int)((i / 21) % 21) - 10
+        };
+        hits += Enemy_isPositionOccupied(pos, state->enemies, state->enemyCount, -1);
+    }
+    g_sink += hits;
+}
+
+static void runEnemyUpdate(BenchState* state, int scale, long iterations) {
+    (void)scale;
+    for (long i = 0; i < iterations; i++) {
+        for (int e = 0; e < state->enemyCount; e++) {
+            Enemy_update(&state->enemies[e], state->playerPos, state->enemies, state->enemyCount, e);
+        }
+    }
+    g_sink += (int)state->enemies[0].base.posX;
+}
+
+static void runCollectVisible(BenchState* state, int scale, long iterations) {
+    (void)scale;
+    int visibleCount = 0;
+    for (long i = 0; i < iterations; i++) {
+        Camera view;
+        Camera_interpolate(&state->world.map.camera, 1.0f, &view);
+
+        ViewRect rect;
+        ViewRect_fromCamera(&view, &rect);
+        visibleCount += Visibility_collectEnemies(&rect, state->enemies, state->enemyCount, 1.0f, state->visible);
+    }
+    g_sink += visibleCount;
+}
+
+static void runRandomPosition(BenchState* state, int scale, long iterations) {
+    (void)scale;
+    int pos[2] = {0, 0};
+    for (long i = 0; i < iterations; i++) {
+        World_randomPositionNearPlayer(&state->world.map, state->playerPos, pos);
+    }
+    g_sink += pos[0];
+}
+
+static void runLoadWorldMap(BenchState* state, int scale, long iterations) {
+    (void)scale;
+    for (long i = 0; i < iterations; i++) {
+        loadWorldMap(ASSET_MAP_WORLD, state->worldTiles);
+    }
+    g_sink += state->worldTiles[0][0];
+}
+
+static void runLoadBlockingMap(BenchState* state, int scale, long iterations) {
+    (void)scale;
+    for (long i = 0; i < iterations; i++) {
+        loadBlockingMap(ASSET_MAP_BLOCKING, state->blockingTiles);
+    }
+    g_sink += state->blockingTiles[0][0];
+}
+
+static void setupBlit(BenchState* state, int scale) {
+    setupWorld(state, scale);
+    for (int i = 0; i < BENCH_BLIT_WIDTH * BENCH_BLIT_HEIGHT; i++) {
+        state->blitSource[i] = 0xFF000000u | (uint32_t)i * 2654435761u;
+    }
+}
+
+static void runBlitScaled(BenchState* state, int scale, long iterations) {
+    const Framebuffer source = {state->blitSource, BENCH_BLIT_WIDTH, BENCH_BLIT_HEIGHT, BENCH_BLIT_WIDTH};
+    Framebuffer frame = {state->frame, WINDOW_WIDTH, WINDOW_HEIGHT, WINDOW_WIDTH};
+    const int width = scale > 0 ? BENCH_BLIT_WIDTH * scale : WINDOW_WIDTH;
+    const int height = scale > 0 ? BENCH_BLIT_HEIGHT * scale : BENCH_FRAME_HEIGHT;
+    for (long i = 0; i < iterations; i++) {
+        Framebuffer_blitScaled(&source, &frame, 0, 0, width, height);
+    }
+    g_sink += (int)state->frame[WINDOW_WIDTH * (height / 2)];
+}
+
+static void setupSprite(BenchState* state, int scale) {
+    setupWorld(state, scale);
+    for (int i = 0; i < BENCH_SPRITE_SIZE * BENCH_SPRITE_SIZE; i++) {
+        const uint32_t color = (uint32_t)i * 2654435761u & 0x00FFFFFFu;
+        state->spriteSource[i] = i % 3 == 0 ? color : 0xFF000000u | color;
+    }
+}
+
+static void setupGlyphs(BenchState* state, int scale) {
+    setupWorld(state, scale);
+    for (int i = 0; i < BENCH_SPRITE_SIZE * BENCH_SPRITE_SIZE; i++) {
+        state->spriteSource[i] = (uint32_t)(i * 7 % 256) << 24 | 0x00FFFFFFu;
+    }
+}
+
+static void runBlitKeyed(BenchState* state, int scale, long iterations) {
+    const Framebuffer source = {state->spriteSource, scale, scale, BENCH_SPRITE_SIZE};
+    Framebuffer frame = {state->frame, WINDOW_WIDTH, WINDOW_HEIGHT, WINDOW_WIDTH};
+    for (long i = 0; i < iterations; i++) {
+        Framebuffer_blitKeyed(&source, &frame, BENCH_SPRITE_X, BENCH_SPRITE_Y, scale, scale, 0xFFFFFFFFu);
+    }
+    g_sink += (int)state->frame[BENCH_SPRITE_Y * WINDOW_WIDTH + BENCH_SPRITE_X];
+}
+
+static void runBlitBlend(BenchState* state, int scale, long iterations) {
+    const Framebuffer source = {state->spriteSource, scale, scale, BENCH_SPRITE_SIZE};
+    Framebuffer frame = {state->frame, WINDOW_WIDTH, WINDOW_HEIGHT, WINDOW_WIDTH};
+    for (long i = 0; i < iterations; i++) {
+        Framebuffer_blitBlend(&source, &frame, BENCH_SPRITE_X, BENCH_SPRITE_Y, scale, scale, BENCH_TEXT_TINT);
+    }
+    g_sink += (int)state->frame[BENCH_SPRITE_Y * WINDOW_WIDTH + BENCH_SPRITE_X];
+}
+
+static void runBlendRect(BenchState* state, int scale, long iterations) {
+    (void)scale;
+    Framebuffer frame = {state->frame, WINDOW_WIDTH, WINDOW_HEIGHT, WINDOW_WIDTH};
+    for (long i = 0; i < iterations; i++) {
+        Framebuffer_blendRect(&frame, 0, 0, WINDOW_WIDTH, WINDOW_HEIGHT, BENCH_OVERLAY_COLOR);
+    }
+    g_sink += (int)state->frame[WINDOW_WIDTH * WINDOW_HEIGHT / 2];
+}
+
+#ifdef NUPRC_BENCH_SDL
+static bool initRenderer(BenchState* state) {
+    if (state->render.renderer) return true;
+
+    SDL_setenv("SDL_VIDEODRIVER", "dummy", 0);
+    if (SDL_Init(SDL_INIT_VIDEO) < 0 || TTF_Init() < 0) {
+        fprintf(stderr, "Bench : initialisation SDL impossible : %s\n", SDL_GetError());
+        return false;
+    }
+
+    state->render.window = SDL_CreateWindow("nuprc_bench", 0, 0, WINDOW_WIDTH, WINDOW_HEIGHT, SDL_WINDOW_HIDDEN);
+    if (!state->render.window) {
+        fprintf(stderr, "Bench : fenetre indisponible : %s\n", SDL_GetError());
+        return false;
+    }
+    state->render.renderer = createSoftwareRenderer(&state->render);
+
+    state->font = TTF_OpenFontRW(openAssetRW(WINDOW_FONT_PATH), 1, WINDOW_FONT_SIZE);
+    Scene_init(&state->scene, state->render.renderer);
+    return true;
+}
+
+static void shutdownRenderer(BenchState* state) {
+    if (!state->render.renderer) return;
+
+    Scene_destroy(&state->scene);
+    Text_shutdown();
+    destroyWorldTarget(&state->render);
+    if (state->font) TTF_CloseFont(state->font);
+    SDL_DestroyRenderer(state->render.renderer);
+    destroyFramebuffer(&state->render);
+    SDL_DestroyWindow(state->render.window);
+    TTF_Quit();
+    SDL_Quit();
+}
+
+static void setupScene(BenchState* state, int scale) {
+    setupWorld(state, scale);
+    if (!initRenderer(state)) exit(EXIT_FAILURE);
+}
+
+static void runDrawMap(BenchState* state, int scale, long iterations) {
+    (void)scale;
+    for (long i = 0; i < iterations; i++) {
+        Scene_drawMap(&state->scene, &state->world.map, false, 1.0f);
+    }
+}
+
+static void runPrintText(BenchState* state, int scale, long iterations) {
+    (void)scale;
+    for (long i = 0; i < iterations; i++) {
+        printTextWithFont(BENCH_TEXT_X, BENCH_TEXT_Y, "Score : 12345", state->font, state->render.renderer);
+    }
+}
+
+static void runWorldFrame(BenchState* state, int scale, long iterations) {
+    (void)scale;
+    for (long i = 0; i < iterations; i++) {
+        beginWorldPass(&state->render);
+        Scene_drawMap(&state->scene, &state->world.map, false, 1.0f);
+        endWorldPass(&state->render);
+        updateDisplay(&state->render);
+    }
+}
+#endif
+
+static const BenchCase CASES[] = {
+    {"Character_moveSmooth",           0,    BENCH_SIMD_NONE,         setupWorld,   runMoveSmooth,       NULL},
+    {"Enemy_isPositionOccupied",       10,   BENCH_SIMD_NONE,         setupEnemies, runPositionOccupied, NULL},
+    {"Enemy_isPositionOccupied",       100,  BENCH_SIMD_NONE,         setupEnemies, runPositionOccupied, NULL},
+    {"Enemy_isPositionOccupied",       1000, BENCH_SIMD_NONE,         setupEnemies, runPositionOccupied, NULL},
+    {"Enemy_update",                   10,   BENCH_SIMD_NONE,         setupEnemies, runEnemyUpdate,      resetEnemies},
+    {"Enemy_update",                   100,  BENCH_SIMD_NONE,         setupEnemies, runEnemyUpdate,      resetEnemies},
+    {"Enemy_update",                   1000, BENCH_SIMD_NONE,         setupEnemies, runEnemyUpdate,      resetEnemies},
+    {"Visibility_collectEnemies",      100,  BENCH_SIMD_NONE,         setupEnemies, runCollectVisible,   NULL},
+    {"Visibility_collectEnemies",      1000, BENCH_SIMD_NONE,         setupEnemies, runCollectVisible,   NULL},
+    {"World_randomPositionNearPlayer", 0,    BENCH_SIMD_NONE,         setupWorld,   runRandomPosition,   NULL},
+    {"loadWorldMap",                   0,    BENCH_SIMD_NONE,         setupWorld,   runLoadWorldMap,     NULL},
+    {"loadBlockingMap",                0,    BENCH_SIMD_NONE,         setupWorld,   runLoadBlockingMap,  NULL},
+    {"Framebuffer_blitScaled",         0,    BENCH_SIMD_NONE,         setupBlit,    runBlitScaled,       NULL},
+    {"Framebuffer_blitScaled",         2,    FRAMEBUFFER_SIMD_SCALAR, setupBlit,    runBlitScaled,       NULL},
+    {"Framebuffer_blitScaled",         2,    FRAMEBUFFER_SIMD_SSE2,   setupBlit,    runBlitScaled,       NULL},
+    {"Framebuffer_blitScaled",         2,    FRAMEBUFFER_SIMD_AVX2,   setupBlit,    runBlitScaled,       NULL},
+    {"Framebuffer_blitScaled",         3,    FRAMEBUFFER_SIMD_SCALAR, setupBlit,    runBlitScaled,       NULL},
+    {"Framebuffer_blitScaled",         3,    FRAMEBUFFER_SIMD_SSE2,   setupBlit,    runBlitScaled,       NULL},
+    {"Framebuffer_blitScaled",         3,    FRAMEBUFFER_SIMD_AVX2,   setupBlit,    runBlitScaled,       NULL},
+    {"Framebuffer_blitKeyed",          32,   FRAMEBUFFER_SIMD_SCALAR, setupSprite,  runBlitKeyed,        NULL},
+    {"Framebuffer_blitKeyed",          32,   FRAMEBUFFER_SIMD_SSE2,   setupSprite,  runBlitKeyed,        NULL},
+    {"Framebuffer_blitKeyed",          32,   FRAMEBUFFER_SIMD_AVX2,   setupSprite,  runBlitKeyed,        NULL},
+    {"Framebuffer_blitBlend",          32,   FRAMEBUFFER_SIMD_SCALAR, setupGlyphs,  runBlitBlend,        NULL},
+    {"Framebuffer_blitBlend",          32,   FRAMEBUFFER_SIMD_SSE2,   setupGlyphs,  runBlitBlend,        NULL},
+    {"Framebuffer_blitBlend",          32,   FRAMEBUFFER_SIMD_AVX2,   setupGlyphs,  runBlitBlend,        NULL},
+    {"Framebuffer_blendRect",          0,    FRAMEBUFFER_SIMD_SCALAR, setupWorld,   runBlendRect,        NULL},
+    {"Framebuffer_blendRect",          0,    FRAMEBUFFER_SIMD_SSE2,   setupWorld,   runBlendRect,        NULL},
+    {"Framebuffer_blendRect",          0,    FRAMEBUFFER_SIMD_AVX2,   setupWorld,   runBlendRect,        NULL},
+#ifdef NUPRC_BENCH_SDL
+    {"Scene_drawMap",                  0,    BENCH_SIMD_NONE,         setupScene,   runDrawMap,          NULL},
+    {"printTextWithFont",              0,    BENCH_SIMD_NONE,         setupScene,   runPrintText,        NULL},
+    {"endWorldPass",                   0,    BENCH_SIMD_NONE,         setupScene,   runWorldFrame,       NULL},
+#endif
+};
+
+static long calibrate(const BenchCase* bench, BenchState* state) {
+    long iterations = 1;
+    for (;;) {
+        if (bench->reset) bench->reset(state, bench->scale);
+        const uint64_t start = timeNowNs();
+        bench->run(state, bench->scale, iterations);
+        const uint64_t elapsed = timeNowNs() - start;
+
+        if (elapsed >= BENCH_TARGET_SAMPLE_NS || iterations >= BENCH_MAX_ITERATIONS) {
+            return iterations;
+        }
+        iterations *= 2;
+    }
+}
+
+static const char* simdLabel(int simd) {
+    return simd == BENCH_SIMD_NONE ? "-" : Framebuffer_simdName((FramebufferSimd)simd);
+}
+
+static void runCase(const BenchCase* bench, BenchState* state, int sampleCount, FILE* out, bool first) {
+    if (bench->simd != BENCH_SIMD_NONE && !Framebuffer_setSimd((FramebufferSimd)bench->simd)) {
+        fprintf(out, "%s\n    {\"name\": \"%s\", \"scale\": %d, \"simd\": \"%s\", \"skipped\": true}",
+                first ? "" : ",", bench->name, bench->scale, simdLabel(bench->simd));
+        fprintf(stderr, "%-32s %5d %-6s  ignore (non supporte par ce CPU)\n",
+                bench->name, bench->scale, simdLabel(bench->simd));
+        return;
+    }
+    if (bench->simd == BENCH_SIMD_NONE) Framebuffer_setSimd(Framebuffer_detectSimd());
+
+    bench->setup(state, bench->scale);
+    const long iterations = calibrate(bench, state);
+
+    double samples[BENCH_MAX_SAMPLES];
+    for (int s = 0; s < sampleCount; s++) {
+        if (bench->reset) bench->reset(state, bench->scale);
+        const uint64_t start = timeNowNs();
+        bench->run(state, bench->scale, iterations);
+        samples[s] = (double)(timeNowNs() - start) / (double)iterations;
+    }
+
+    BenchStats stats;
+    computeStats(samples, sampleCount, &stats);
+
+    fprintf(out, "%s\n    {\"name\": \"%s\", \"scale\": %d, \"simd\": \"%s\", \"iterations\": %ld, "
+                 "\"unit\": \"ns/op\", \"mean\": %.2f, \"stddev\": %.2f, \"min\": %.2f, \"p50\": %.2f, \"p90\": %.2f, "
+                 "\"p99\": %.2f, \"max\": %.2f}",
+            first ? "" : ",", bench->name, bench->scale, simdLabel(bench->simd), iterations,
+            stats.mean, stats.stddev, stats.min, stats.p50, stats.p90, stats.p99, stats.max);
+
+    fprintf(stderr, "%-32s %5d %-6s  %12.1f ns/op  (+/- %.1f, p99 %.1f)\n",
+            bench->name, bench->scale, simdLabel(bench->simd), stats.mean, stats.stddev, stats.p99);
+}
+
+static bool parseOptions(int argc, char* argv[], BenchOptions* options) {
+    options->samples = BENCH_DEFAULT_SAMPLES;
+    options->filter = NULL;
+    options->outputPath = NULL;
+
+    for (int i = 1; i < argc; i++) {
+        const bool hasValue = i + 1 < argc;
+
+        if (strcmp(argv[i], "--samples") == 0 && hasValue) {
+            options->samples = (int)strtol(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--filter") == 0 && hasValue) {
+            options->filter = argv[++i];
+        } else if (strcmp(argv[i], "--out") == 0 && hasValue) {
+            options->outputPath = argv[++i];
+        } else {
+            return false;
+        }
+    }
+
+    return options->samples > 0 && options->samples <= BENCH_MAX_SAMPLES;
+}
+
+int main(int argc, char* argv[]) {
+    BenchOptions options;
+    if (!parseOptions(argc, argv, &options)) {
+        fprintf(stderr, "Usage : %s [--samples N] [--filter NOM] [--out FICHIER.json]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    if (!assets_initFromExecutable(argv[0])) {
+        fprintf(stderr, "Impossible d'initialiser le resolver d'assets\n");
+        return EXIT_FAILURE;
+    }
+
+    FILE* out = stdout;
+    if (options.outputPath) {
+        out = fopen(options.outputPath, "w");
+        if (!out) {
+            fprintf(stderr, "Impossible d'ecrire %s\n", options.outputPath);
+            return EXIT_FAILURE;
+        }
+    }
+
+    static BenchState state;
+
+    fprintf(out, "{\n  \"benchmark\": \"nuprc_bench\",\n  \"samples\": %d,\n  \"results\": [", options.samples);
+
+    bool first = true;
+    const int caseCount = (int)(sizeof(CASES) / sizeof(CASES[0]));
+    for (int i = 0; i < caseCount; i++) {
+        if (options.filter && !strstr(CASES[i].name, options.filter)) continue;
+
+        runCase(&CASES[i], &state, options.samples, out, first);
+        first = false;
+    }
+
+    fprintf(out, "\n  ]\n}\n");
+    if (out != stdout) fclose(out);
+
+#ifdef NUPRC_BENCH_SDL
+    shutdownRenderer(&state);
+#endif
+    Framebuffer_shutdown();
+    return EXIT_SUCCESS;
+}
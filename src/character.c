@@ -1,5 +1,4 @@
 #include "character.h"
-#include "render.h"
 
 static float absf(float value) {
     return value < 0.0f ? -value : value;
@@ -65,7 +64,8 @@ void Character_init(Character* c, CharacterType type, int lives, Map* map) {
     c->lives = lives;
     c->posX = 0.0f;
     c->posY = 0.0f;
-    c->texture = NULL;
+    c->prevX = 0.0f;
+    c->prevY = 0.0f;
     c->map = map;
 }
 
@@ -75,6 +75,18 @@ void Character_getGridPos(const Character* c, int gridPos[2]) {
     gridPos[1] = roundToGrid(c->posY);
 }
 
+void Character_savePosition(Character* c) {
+    if (!c) return;
+    c->prevX = c->posX;
+    c->prevY = c->posY;
+}
+
+void Character_getRenderPos(const Character* c, float alpha, float renderPos[2]) {
+    if (!c || !renderPos) return;
+    renderPos[0] = c->prevX + (c->posX - c->prevX) * alpha;
+    renderPos[1] = c->prevY + (c->posY - c->prevY) * alpha;
+}
+
 void Character_moveSmooth(Character* c, float deltaX, float deltaY) {
     if (!c || !c->map) return;
 
@@ -94,20 +106,3 @@ void Character_move(Character* c, const int delta[2]) {
         c->posY = (float)newPos[1];
     }
 }
-
-void Character_draw(const Character* c, SDL_Renderer* renderer) {
-    if (!c || !c->texture || !renderer || !c->map) return;
-
-    int screenPos[2];
-    Camera_worldToScreenF(&c->map->camera, c->posX, c->posY, screenPos);
-    renderTexture(c->texture, renderer, screenPos[0], screenPos[1],
-                  GRID_CELL_SIZE, GRID_CELL_SIZE);
-}
-
-void Character_destroy(Character* c) {
-    if (!c) return;
-    if (c->texture) {
-        SDL_DestroyTexture(c->texture);
-        c->texture = NULL;
-    }
-}
@@ -1,8 +1,6 @@
 #include "enemy.h"
 #include "map.h"
-#include "render.h"
 #include "utils.h"
-#include <stdlib.h>
 
 #define ENEMY_BASIC_MOVE_INTERVAL   70
 #define ENEMY_FAST_MOVE_INTERVAL    45
@@ -44,7 +42,7 @@ static void calculateChaseMove(const Enemy* enemy, const int targetPos[2], int d
 
 static void calculateRandomMove(int delta[2]) {
     const int deltas[4][2] = {{0, -1}, {0, 1}, {-1, 0}, {1, 0}};
-    int direction = rand() % 4;
+    int direction = randomInt(4);
     delta[0] = deltas[direction][0];
     delta[1] = deltas[direction][1];
 }
@@ -62,6 +60,7 @@ void Enemy_init(Enemy* enemy, EnemyType type, EnemyAI ai, Map* map, const int in
 
     enemy->base.posX = (float)initialPos[0];
     enemy->base.posY = (float)initialPos[1];
+    Character_savePosition(&enemy->base);
     enemy->enemyType = type;
     enemy->ai = ai;
     enemy->moveTimer = 0;
@@ -71,9 +70,6 @@ void Enemy_init(Enemy* enemy, EnemyType type, EnemyAI ai, Map* map, const int in
     enemy->hitTimer = 0;
 
     Animation_init(&enemy->animation);
-    SpriteSet_loadEnemy(&enemy->sprites, map->renderer);
-
-    enemy->base.texture = NULL;
 }
 
 void Enemy_update(Enemy* enemy, const int playerPos[2], const Enemy* allEnemies, int enemyCount, int selfIndex) {
@@ -172,54 +168,6 @@ bool Enemy_takeDamage(Enemy* enemy, int damage) {
     return false;
 }
 
-void Enemy_draw(const Enemy* enemy, SDL_Renderer* renderer) {
-    if (!enemy->isActive) return;
-
-    if (enemy->hitTimer > 0 && (enemy->hitTimer / 3) % 2 == 0) {
-        return;
-    }
-
-    SDL_Texture* texture = Animation_getCurrentTexture(&enemy->animation, &enemy->sprites);
-    if (!texture) return;
-
-    int screenPos[2];
-    Camera_worldToScreenF(&enemy->base.map->camera, enemy->base.posX, enemy->base.posY, screenPos);
-
-    if (enemy->hitTimer > 0) {
-        SDL_SetTextureColorMod(texture, 255, 100, 100);
-    }
-
-    renderTexture(texture, renderer, screenPos[0], screenPos[1], GRID_CELL_SIZE, GRID_CELL_SIZE);
-
-    if (enemy->hitTimer > 0) {
-        SDL_SetTextureColorMod(texture, 255, 255, 255);
-    }
-
-    int maxLives = getEnemyLives(enemy->enemyType);
-    if (maxLives > 1) {
-        int barWidth = GRID_CELL_SIZE - 10;
-        int barHeight = 4;
-        int barX = screenPos[0] + 5;
-        int barY = screenPos[1] - 6;
-
-        SDL_SetRenderDrawColor(renderer, 60, 60, 60, 255);
-        SDL_Rect bgRect = {barX, barY, barWidth, barHeight};
-        SDL_RenderFillRect(renderer, &bgRect);
-
-        int healthWidth = (enemy->base.lives * barWidth) / maxLives;
-        int r = 255 - (enemy->base.lives * 255 / maxLives);
-        int g = (enemy->base.lives * 255 / maxLives);
-        SDL_SetRenderDrawColor(renderer, r, g, 0, 255);
-        SDL_Rect healthRect = {barX, barY, healthWidth, barHeight};
-        SDL_RenderFillRect(renderer, &healthRect);
-
-        SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255);
-        SDL_RenderDrawRect(renderer, &bgRect);
-    }
-}
-
-void Enemy_destroy(Enemy* enemy) {
-    SpriteSet_destroy(&enemy->sprites);
-    Character_destroy(&enemy->base);
-    enemy->isActive = false;
+int Enemy_getMaxLives(const Enemy* enemy) {
+    return getEnemyLives(enemy->enemyType);
 }
@@ -0,0 +1,155 @@
+#include "flightrecorder.h"
+#include "utils.h"
+
+#include <time.h>
+
+typedef struct {
+    char  name[FLIGHT_ASSET_NAME_SIZE];
+    float ms;
+} FlightAsset;
+
+typedef struct {
+    long        index;
+    uint64_t    timeNs;
+    float       frameMs;
+    float       zoneMs[PROFILE_ZONE_COUNT];
+    int         entityCount;
+    int         assetCount;
+    FlightAsset assets[FLIGHT_MAX_ASSETS];
+} FlightFrame;
+
+static FlightFrame g_frames[FLIGHT_HISTORY];
+static int         g_head = 0;
+static int         g_count = 0;
+static long        g_frameIndex = 0;
+
+static FlightFrame g_current;
+
+static float       g_thresholdMs = FLIGHT_DEFAULT_THRESHOLD_MS;
+static const char* g_reportPrefix = "nuprc_hitch";
+static int         g_reportCount = 0;
+static uint64_t    g_lastReportNs = 0;
+
+static const FlightFrame* frameAt(int age) {
+    int index = g_head - 1 - age;
+    if (index < 0) index += FLIGHT_HISTORY;
+    return &g_frames[index];
+}
+
+static int recentFrames(uint64_t nowNs) {
+    int count = 0;
+    while (count < g_count && nowNs - frameAt(count)->timeNs <= FLIGHT_HISTORY_NS) {
+        count++;
+    }
+    return count;
+}
+
+static void writeFrameRow(FILE* file, const FlightFrame* frame) {
+    fprintf(file, "%8ld %8.2f", frame->index, frame->frameMs);
+    for (int zone = 0; zone < PROFILE_ZONE_COUNT; zone++) {
+        fprintf(file, " %8.2f", frame->zoneMs[zone]);
+    }
+    fprintf(file, " %8d %6d\n", frame->entityCount, frame->assetCount);
+}
+
+static void writeReport(const FlightFrame* hitch) {
+    char path[256];
+    snprintf(path, sizeof(path), "%s_%ld.txt", g_reportPrefix, hitch->index);
+
+    FILE* file = fopen(path, "w");
+    if (!file) {
+        fprintf(stderr, "Flight recorder : impossible d'ecrire %s\n", path);
+        return;
+    }
+
+    char date[32] = "";
+    const time_t now = time(NULL);
+    const struct tm* local = localtime(&now);
+    if (local) strftime(date, sizeof(date), "%Y-%m-%d %H:%M:%S", local);
+
+    fprintf(file, "# NUPRC - rapport de hitch\n");
+    fprintf(file, "date     : %s\n", date);
+    fprintf(file, "frame    : %ld\n", hitch->index);
+    fprintf(file, "duree    : %.2f ms (seuil %.2f ms)\n", hitch->frameMs, g_thresholdMs);
+    fprintf(file, "entites  : %d\n\n", hitch->entityCount);
+
+    fprintf(file, "## Assets charges pendant la frame\n");
+    if (hitch->assetCount == 0) {
+        fprintf(file, "  (aucun)\n");
+    }
+    for (int i = 0; i < hitch->assetCount && i < FLIGHT_MAX_ASSETS; i++) {
+        fprintf(file, "  %8.2f ms  %s\n", hitch->assets[i].ms, hitch->assets[i].name);
+    }
+    if (hitch->assetCount > FLIGHT_MAX_ASSETS) {
+        fprintf(file, "  ... %d autres\n", hitch->assetCount - FLIGHT_MAX_ASSETS);
+    }
+
+    const int recent = recentFrames(hitch->timeNs);
+    fprintf(file, "\n## %d frames des %d dernieres secondes (ms)\n", recent, FLIGHT_HISTORY_SECONDS);
+    fprintf(file, "%8s %8s", "frame", "total");
+    for (int zone = 0; zone < PROFILE_ZONE_COUNT; zone++) {
+        const char* name = Profiler_zoneName((ProfileZone)zone);
+        while (*name == ' ') name++;
+        fprintf(file, " %8.8s", name);
+    }
+    fprintf(file, " %8s %6s\n", "entites", "assets");
+
+    for (int age = recent - 1; age >= 0; age--) {
+        writeFrameRow(file, frameAt(age));
+    }
+
+    fprintf(file, "\n## Assets charges sur la periode\n");
+    for (int age = recent - 1; age >= 0; age--) {
+        const FlightFrame* frame = frameAt(age);
+        for (int i = 0; i < frame->assetCount && i < FLIGHT_MAX_ASSETS; i++) {
+            fprintf(file, "%8ld %8.2f ms  %s\n", frame->index, frame->assets[i].ms, frame->assets[i].name);
+        }
+    }
+
+    fclose(file);
+    fprintf(stderr, "Hitch de %.1f ms a la frame %ld : rapport %s\n", hitch->frameMs, hitch->index, path);
+}
+
+void FlightRecorder_setThreshold(float thresholdMs) {
+    g_thresholdMs = thresholdMs;
+}
+
+void FlightRecorder_setReportPrefix(const char* reportPrefix) {
+    if (reportPrefix) g_reportPrefix = reportPrefix;
+}
+
+void FlightRecorder_noteAsset(const char* name, uint64_t durationNs) {
+    if (g_current.assetCount < FLIGHT_MAX_ASSETS) {
+        FlightAsset* asset = &g_current.assets[g_current.assetCount];
+        strncpy(asset->name, name ? name : "?", FLIGHT_ASSET_NAME_SIZE - 1);
+        asset->name[FLIGHT_ASSET_NAME_SIZE - 1] = '\0';
+        asset->ms = (float)((double)durationNs / 1e6);
+    }
+    g_current.assetCount++;
+}
+
+void FlightRecorder_setEntityCount(int count) {
+    g_current.entityCount = count;
+}
+
+void FlightRecorder_endFrame(const float zoneMs[PROFILE_ZONE_COUNT], float frameMs) {
+    g_current.index = g_frameIndex++;
+    g_current.timeNs = timeNowNs();
+    g_current.frameMs = frameMs;
+    memcpy(g_current.zoneMs, zoneMs, sizeof(g_current.zoneMs));
+
+    g_frames[g_head] = g_current;
+    g_head = (g_head + 1) % FLIGHT_HISTORY;
+    if (g_count < FLIGHT_HISTORY) g_count++;
+
+    const bool hitch = g_thresholdMs > 0.0f && frameMs > g_thresholdMs;
+    const bool cooledDown = g_reportCount == 0 || g_current.timeNs - g_lastReportNs >= FLIGHT_HISTORY_NS;
+    if (hitch && cooledDown && g_reportCount < FLIGHT_MAX_REPORTS) {
+        writeReport(&g_current);
+        g_reportCount++;
+        g_lastReportNs = g_current.timeNs;
+    }
+
+    g_current.assetCount = 0;
+    g_current.entityCount = 0;
+}
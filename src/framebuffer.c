@@ -0,0 +1,520 @@
+#include "framebuffer.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define FRAMEBUFFER_X86 1
+#include <immintrin.h>
+#endif
+
+typedef void (*ReplicateRowFn)(const uint32_t* src, uint32_t* dst, int factor, int count);
+typedef void (*SpriteRowFn)(const uint32_t* src, uint32_t* dst, int count, uint32_t tint);
+typedef void (*FillRowFn)(uint32_t* dst, int count, uint32_t color);
+
+#define OPAQUE          0xFF000000u
+#define WHITE           0xFFFFFFFFu
+
+static const char* SIMD_NAMES[FRAMEBUFFER_SIMD_COUNT] = {
+    [FRAMEBUFFER_SIMD_SCALAR] = "scalar",
+    [FRAMEBUFFER_SIMD_SSE2]   = "sse2",
+    [FRAMEBUFFER_SIMD_AVX2]   = "avx2"
+};
+
+static void expandRow(const uint32_t* src, uint32_t* dst, const int32_t* columns, int count) {
+    for (int i = 0; i < count; i++) {
+        dst[i] = src[columns[i]];
+    }
+}
+
+static void replicateTail(const uint32_t* src, uint32_t* dst, int factor, int start, int count) {
+    for (int i = start; i < count; i++) {
+        dst[i] = src[i / factor];
+    }
+}
+
+static void replicateRowScalar(const uint32_t* src, uint32_t* dst, int factor, int count) {
+    const int whole = count / factor;
+    for (int p = 0; p < whole; p++) {
+        const uint32_t pixel = src[p];
+        for (int k = 0; k < factor; k++) {
+            *dst++ = pixel;
+        }
+    }
+    replicateTail(src, dst - whole * factor, factor, whole * factor, count);
+}
+
+static inline uint32_t mul255(uint32_t a, uint32_t b) {
+    const uint32_t t = a * b + 128;
+    return (t + (t >> 8)) >> 8;
+}
+
+static inline uint32_t blendChannel(uint32_t s, uint32_t d, uint32_t a) {
+    const uint32_t t = s * a + d * (255 - a) + 128;
+    return (t + (t >> 8)) >> 8;
+}
+
+static inline uint32_t tintPixel(uint32_t pixel, uint32_t tint) {
+    uint32_t result = 0;
+    for (int shift = 0; shift < 32; shift += 8) {
+        result |= mul255(pixel >> shift & 0xFF, tint >> shift & 0xFF) << shift;
+    }
+    return result;
+}
+
+static inline uint32_t blendPixel(uint32_t s, uint32_t d) {
+    const uint32_t a = s >> 24;
+    uint32_t result = OPAQUE;
+    for (int shift = 0; shift < 24; shift += 8) {
+        result |= blendChannel(s >> shift & 0xFF, d >> shift & 0xFF, a) << shift;
+    }
+    return result;
+}
+
+static void keyRowScalar(const uint32_t* src, uint32_t* dst, int count, uint32_t tint) {
+    for (int i = 0; i < count; i++) {
+        if ((src[i] & OPAQUE) == 0) continue;
+        dst[i] = OPAQUE | tintPixel(src[i], tint);
+    }
+}
+
+static void blendRowScalar(const uint32_t* src, uint32_t* dst, int count, uint32_t tint) {
+    for (int i = 0; i < count; i++) {
+        dst[i] = blendPixel(tintPixel(src[i], tint), dst[i]);
+    }
+}
+
+static void fillBlendRowScalar(uint32_t* dst, int count, uint32_t color) {
+    for (int i = 0; i < count; i++) {
+        dst[i] = blendPixel(color, dst[i]);
+    }
+}
+
+#ifdef FRAMEBUFFER_X86
+__attribute__((target("sse2")))
+static void replicateRowSse2(const uint32_t* src, uint32_t* dst, int factor, int count) {
+    int i = 0;
+    int p = 0;
+
+    if (factor == 2) {
+        for (; i + 8 <= count; i += 8, p += 4) {
+            const __m128i v = _mm_loadu_si128((const __m128i*)(src + p));
+            _mm_storeu_si128((__m128i*)(dst + i), _mm_unpacklo_epi32(v, v));
+            _mm_storeu_si128((__m128i*)(dst + i + 4), _mm_unpackhi_epi32(v, v));
+        }
+    } else if (factor == 3) {
+        for (; i + 12 <= count; i += 12, p += 4) {
+            const __m128i v = _mm_loadu_si128((const __m128i*)(src + p));
+            _mm_storeu_si128((__m128i*)(dst + i), _mm_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 0, 0)));
+            _mm_storeu_si128((__m128i*)(dst + i + 4), _mm_shuffle_epi32(v, _MM_SHUFFLE(2, 2, 1, 1)));
+            _mm_storeu_si128((__m128i*)(dst + i + 8), _mm_shuffle_epi32(v, _MM_SHUFFLE(3, 3, 3, 2)));
+        }
+    } else {
+        for (; i + factor <= count; i += factor, p++) {
+            const __m128i v = _mm_set1_epi32((int)src[p]);
+            int k = 0;
+            for (; k + 4 <= factor; k += 4) {
+                _mm_storeu_si128((__m128i*)(dst + i + k), v);
+            }
+            for (; k < factor; k++) {
+                dst[i + k] = src[p];
+            }
+        }
+    }
+
+    replicateTail(src, dst, factor, i, count);
+}
+
+__attribute__((target("sse2")))
+static inline __m128i mul255Sse2(__m128i a, __m128i b) {
+    const __m128i t = _mm_add_epi16(_mm_mullo_epi16(a, b), _mm_set1_epi16(128));
+    return _mm_srli_epi16(_mm_add_epi16(t, _mm_srli_epi16(t, 8)), 8);
+}
+
+__attribute__((target("sse2")))
+static inline __m128i blendHalfSse2(__m128i s, __m128i d) {
+    const __m128i alpha = _mm_shufflehi_epi16(_mm_shufflelo_epi16(s, _MM_SHUFFLE(3, 3, 3, 3)),
+                                              _MM_SHUFFLE(3, 3, 3, 3));
+    const __m128i inverse = _mm_sub_epi16(_mm_set1_epi16(255), alpha);
+    const __m128i t = _mm_add_epi16(_mm_add_epi16(_mm_mullo_epi16(s, alpha), _mm_mullo_epi16(d, inverse)),
+                                    _mm_set1_epi16(128));
+    return _mm_srli_epi16(_mm_add_epi16(t, _mm_srli_epi16(t, 8)), 8);
+}
+
+__attribute__((target("sse2")))
+static inline __m128i tintSse2(__m128i pixels, __m128i tint) {
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i low = mul255Sse2(_mm_unpacklo_epi8(pixels, zero), tint);
+    const __m128i high = mul255Sse2(_mm_unpackhi_epi8(pixels, zero), tint);
+    return _mm_packus_epi16(low, high);
+}
+
+__attribute__((target("sse2")))
+static inline __m128i blendSse2(__m128i s, __m128i d) {
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i low = blendHalfSse2(_mm_unpacklo_epi8(s, zero), _mm_unpacklo_epi8(d, zero));
+    const __m128i high = blendHalfSse2(_mm_unpackhi_epi8(s, zero), _mm_unpackhi_epi8(d, zero));
+    return _mm_or_si128(_mm_packus_epi16(low, high), _mm_set1_epi32((int)OPAQUE));
+}
+
+__attribute__((target("sse2")))
+static inline __m128i tintLanesSse2(uint32_t tint) {
+    return _mm_unpacklo_epi8(_mm_set1_epi32((int)tint), _mm_setzero_si128());
+}
+
+__attribute__((target("sse2")))
+static void keyRowSse2(const uint32_t* src, uint32_t* dst, int count, uint32_t tint) {
+    const __m128i tintLanes = tintLanesSse2(tint);
+    const __m128i opaque = _mm_set1_epi32((int)OPAQUE);
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const __m128i s = _mm_loadu_si128((const __m128i*)(src + i));
+        const __m128i d = _mm_loadu_si128((const __m128i*)(dst + i));
+        const __m128i keyed = _mm_cmpeq_epi32(_mm_and_si128(s, opaque), _mm_setzero_si128());
+        const __m128i pixel = _mm_or_si128(tint == WHITE ? s : tintSse2(s, tintLanes), opaque);
+        _mm_storeu_si128((__m128i*)(dst + i), _mm_or_si128(_mm_and_si128(keyed, d), _mm_andnot_si128(keyed, pixel)));
+    }
+    keyRowScalar(src + i, dst + i, count - i, tint);
+}
+
+__attribute__((target("sse2")))
+static void blendRowSse2(const uint32_t* src, uint32_t* dst, int count, uint32_t tint) {
+    const __m128i tintLanes = tintLanesSse2(tint);
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128i s = _mm_loadu_si128((const __m128i*)(src + i));
+        if (tint != WHITE) s = tintSse2(s, tintLanes);
+        const __m128i d = _mm_loadu_si128((const __m128i*)(dst + i));
+        _mm_storeu_si128((__m128i*)(dst + i), blendSse2(s, d));
+    }
+    blendRowScalar(src + i, dst + i, count - i, tint);
+}
+
+__attribute__((target("sse2")))
+static void fillBlendRowSse2(uint32_t* dst, int count, uint32_t color) {
+    const __m128i s = _mm_set1_epi32((int)color);
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const __m128i d = _mm_loadu_si128((const __m128i*)(dst + i));
+        _mm_storeu_si128((__m128i*)(dst + i), blendSse2(s, d));
+    }
+    fillBlendRowScalar(dst + i, count - i, color);
+}
+
+__attribute__((target("avx2")))
+static void replicateRowAvx2(const uint32_t* src, uint32_t* dst, int factor, int count) {
+    __m256i lanes[FRAMEBUFFER_MAX_REPLICATE];
+    for (int v = 0; v < factor; v++) {
+        int32_t index[8];
+        for (int l = 0; l < 8; l++) {
+            index[l] = (v * 8 + l) / factor;
+        }
+        lanes[v] = _mm256_loadu_si256((const __m256i*)index);
+    }
+
+    const int step = 8 * factor;
+    int i = 0;
+    int p = 0;
+    for (; i + step <= count; i += step, p += 8) {
+        const __m256i pixels = _mm256_loadu_si256((const __m256i*)(src + p));
+        for (int v = 0; v < factor; v++) {
+            _mm256_storeu_si256((__m256i*)(dst + i + v * 8), _mm256_permutevar8x32_epi32(pixels, lanes[v]));
+        }
+    }
+
+    replicateTail(src, dst, factor, i, count);
+}
+
+__attribute__((target("avx2")))
+static inline __m256i mul255Avx2(__m256i a, __m256i b) {
+    const __m256i t = _mm256_add_epi16(_mm256_mullo_epi16(a, b), _mm256_set1_epi16(128));
+    return _mm256_srli_epi16(_mm256_add_epi16(t, _mm256_srli_epi16(t, 8)), 8);
+}
+
+__attribute__((target("avx2")))
+static inline __m256i blendHalfAvx2(__m256i s, __m256i d) {
+    const __m256i alpha = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(s, _MM_SHUFFLE(3, 3, 3, 3)),
+                                                 _MM_SHUFFLE(3, 3, 3, 3));
+    const __m256i inverse = _mm256_sub_epi16(_mm256_set1_epi16(255), alpha);
+    const __m256i t = _mm256_add_epi16(_mm256_add_epi16(_mm256_mullo_epi16(s, alpha),
+                                                        _mm256_mullo_epi16(d, inverse)),
+                                       _mm256_set1_epi16(128));
+    return _mm256_srli_epi16(_mm256_add_epi16(t, _mm256_srli_epi16(t, 8)), 8);
+}
+
+__attribute__((target("avx2")))
+static inline __m256i tintAvx2(__m256i pixels, __m256i tint) {
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i low = mul255Avx2(_mm256_unpacklo_epi8(pixels, zero), tint);
+    const __m256i high = mul255Avx2(_mm256_unpackhi_epi8(pixels, zero), tint);
+    return _mm256_packus_epi16(low, high);
+}
+
+__attribute__((target("avx2")))
+static inline __m256i blendAvx2(__m256i s, __m256i d) {
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i low = blendHalfAvx2(_mm256_unpacklo_epi8(s, zero), _mm256_unpacklo_epi8(d, zero));
+    const __m256i high = blendHalfAvx2(_mm256_unpackhi_epi8(s, zero), _mm256_unpackhi_epi8(d, zero));
+    return _mm256_or_si256(_mm256_packus_epi16(low, high), _mm256_set1_epi32((int)OPAQUE));
+}
+
+__attribute__((target("avx2")))
+static inline __m256i tintLanesAvx2(uint32_t tint) {
+    return _mm256_unpacklo_epi8(_mm256_set1_epi32((int)tint), _mm256_setzero_si256());
+}
+
+__attribute__((target("avx2")))
+static void keyRowAvx2(const uint32_t* src, uint32_t* dst, int count, uint32_t tint) {
+    const __m256i tintLanes = tintLanesAvx2(tint);
+    const __m256i opaque = _mm256_set1_epi32((int)OPAQUE);
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const __m256i s = _mm256_loadu_si256((const __m256i*)(src + i));
+        const __m256i d = _mm256_loadu_si256((const __m256i*)(dst + i));
+        const __m256i keyed = _mm256_cmpeq_epi32(_mm256_and_si256(s, opaque), _mm256_setzero_si256());
+        const __m256i pixel = _mm256_or_si256(tint == WHITE ? s : tintAvx2(s, tintLanes), opaque);
+        _mm256_storeu_si256((__m256i*)(dst + i), _mm256_blendv_epi8(pixel, d, keyed));
+    }
+    keyRowScalar(src + i, dst + i, count - i, tint);
+}
+
+__attribute__((target("avx2")))
+static void blendRowAvx2(const uint32_t* src, uint32_t* dst, int count, uint32_t tint) {
+    const __m256i tintLanes = tintLanesAvx2(tint);
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256i s = _mm256_loadu_si256((const __m256i*)(src + i));
+        if (tint != WHITE) s = tintAvx2(s, tintLanes);
+        const __m256i d = _mm256_loadu_si256((const __m256i*)(dst + i));
+        _mm256_storeu_si256((__m256i*)(dst + i), blendAvx2(s, d));
+    }
+    blendRowScalar(src + i, dst + i, count - i, tint);
+}
+
+__attribute__((target("avx2")))
+static void fillBlendRowAvx2(uint32_t* dst, int count, uint32_t color) {
+    const __m256i s = _mm256_set1_epi32((int)color);
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const __m256i d = _mm256_loadu_si256((const __m256i*)(dst + i));
+        _mm256_storeu_si256((__m256i*)(dst + i), blendAvx2(s, d));
+    }
+    fillBlendRowScalar(dst + i, count - i, color);
+}
+#endif
+
+static FramebufferSimd g_simd = FRAMEBUFFER_SIMD_SCALAR;
+static bool            g_simdChosen = false;
+static ReplicateRowFn  g_replicateRow = replicateRowScalar;
+static SpriteRowFn     g_keyRow = keyRowScalar;
+static SpriteRowFn     g_blendRow = blendRowScalar;
+static FillRowFn       g_fillBlendRow = fillBlendRowScalar;
+static int32_t*        g_columns = NULL;
+static int             g_columnCapacity = 0;
+static uint32_t*       g_line = NULL;
+static int             g_lineCapacity = 0;
+
+static bool simdSupported(FramebufferSimd level) {
+    switch (level) {
+        case FRAMEBUFFER_SIMD_SCALAR:
+            return true;
+#ifdef FRAMEBUFFER_X86
+        case FRAMEBUFFER_SIMD_SSE2:
+            return __builtin_cpu_supports("sse2");
+        case FRAMEBUFFER_SIMD_AVX2:
+            return __builtin_cpu_supports("avx2");
+#endif
+        default:
+            return false;
+    }
+}
+
+FramebufferSimd Framebuffer_detectSimd(void) {
+    if (simdSupported(FRAMEBUFFER_SIMD_AVX2)) return FRAMEBUFFER_SIMD_AVX2;
+    if (simdSupported(FRAMEBUFFER_SIMD_SSE2)) return FRAMEBUFFER_SIMD_SSE2;
+    return FRAMEBUFFER_SIMD_SCALAR;
+}
+
+bool Framebuffer_isSupported(FramebufferSimd level) {
+    return (int)level >= 0 && level < FRAMEBUFFER_SIMD_COUNT && simdSupported(level);
+}
+
+bool Framebuffer_setSimd(FramebufferSimd level) {
+    if (!Framebuffer_isSupported(level)) return false;
+
+    g_simd = level;
+    g_simdChosen = true;
+    g_replicateRow = replicateRowScalar;
+    g_keyRow = keyRowScalar;
+    g_blendRow = blendRowScalar;
+    g_fillBlendRow = fillBlendRowScalar;
+#ifdef FRAMEBUFFER_X86
+    if (level == FRAMEBUFFER_SIMD_SSE2) {
+        g_replicateRow = replicateRowSse2;
+        g_keyRow = keyRowSse2;
+        g_blendRow = blendRowSse2;
+        g_fillBlendRow = fillBlendRowSse2;
+    } else if (level == FRAMEBUFFER_SIMD_AVX2) {
+        g_replicateRow = replicateRowAvx2;
+        g_keyRow = keyRowAvx2;
+        g_blendRow = blendRowAvx2;
+        g_fillBlendRow = fillBlendRowAvx2;
+    }
+#endif
+    return true;
+}
+
+FramebufferSimd Framebuffer_getSimd(void) {
+    if (!g_simdChosen) Framebuffer_setSimd(Framebuffer_detectSimd());
+    return g_simd;
+}
+
+const char* Framebuffer_simdName(FramebufferSimd level) {
+    if ((int)level < 0 || level >= FRAMEBUFFER_SIMD_COUNT) return "?";
+    return SIMD_NAMES[level];
+}
+
+bool Framebuffer_parseSimd(const char* name, FramebufferSimd* level) {
+    for (int i = 0; i < FRAMEBUFFER_SIMD_COUNT; i++) {
+        if (strcmp(name, SIMD_NAMES[i]) == 0) {
+            *level = (FramebufferSimd)i;
+            return true;
+        }
+    }
+    return false;
+}
+
+void Framebuffer_shutdown(void) {
+    free(g_columns);
+    g_columns = NULL;
+    g_columnCapacity = 0;
+    free(g_line);
+    g_line = NULL;
+    g_lineCapacity = 0;
+}
+
+static bool reserveColumns(int count) {
+    if (count <= g_columnCapacity) return true;
+
+    int32_t* columns = realloc(g_columns, (size_t)count * sizeof(int32_t));
+    if (columns == NULL) return false;
+    g_columns = columns;
+    g_columnCapacity = count;
+    return true;
+}
+
+static bool reserveLine(int count) {
+    if (count <= g_lineCapacity) return true;
+
+    uint32_t* line = realloc(g_line, (size_t)count * sizeof(uint32_t));
+    if (line == NULL) return false;
+    g_line = line;
+    g_lineCapacity = count;
+    return true;
+}
+
+static bool clipRect(const Framebuffer* dst, int x, int y, int w, int h, int bounds[4]) {
+    bounds[0] = x < 0 ? 0 : x;
+    bounds[1] = y < 0 ? 0 : y;
+    bounds[2] = x + w > dst->width ? dst->width : x + w;
+    bounds[3] = y + h > dst->height ? dst->height : y + h;
+    return w > 0 && h > 0 && bounds[0] < bounds[2] && bounds[1] < bounds[3];
+}
+
+void Framebuffer_blitScaled(const Framebuffer* src, Framebuffer* dst, int x, int y, int w, int h) {
+    int bounds[4];
+    if (src->width <= 0 || src->height <= 0 || !clipRect(dst, x, y, w, h, bounds)) return;
+    Framebuffer_getSimd();
+
+    const int left = bounds[0];
+    const int count = bounds[2] - left;
+    const int factor = w % src->width == 0 ? w / src->width : 0;
+    const bool sameWidth = factor == 1 && left == x;
+    const bool replicate = factor > 1 && factor <= FRAMEBUFFER_MAX_REPLICATE && left == x;
+    if (!sameWidth && !replicate) {
+        if (!reserveColumns(count)) return;
+        for (int i = 0; i < count; i++) {
+            g_columns[i] = (int32_t)((int64_t)(left + i - x) * src->width / w);
+        }
+    }
+
+    int previousRow = -1;
+    const uint32_t* previousLine = NULL;
+    for (int row = bounds[1]; row < bounds[3]; row++) {
+        const int sourceRow = (int)((int64_t)(row - y) * src->height / h);
+        const uint32_t* sourceLine = src->pixels + (size_t)sourceRow * src->stride;
+        uint32_t* line = dst->pixels + (size_t)row * dst->stride + left;
+
+        if (sourceRow == previousRow) {
+            memcpy(line, previousLine, (size_t)count * sizeof(uint32_t));
+        } else if (sameWidth) {
+            memcpy(line, sourceLine, (size_t)count * sizeof(uint32_t));
+        } else if (replicate) {
+            g_replicateRow(sourceLine, line, factor, count);
+        } else {
+            expandRow(sourceLine, line, g_columns, count);
+        }
+
+        previousRow = sourceRow;
+        previousLine = line;
+    }
+}
+
+void Framebuffer_fillRect(Framebuffer* dst, int x, int y, int w, int h, uint32_t color) {
+    int bounds[4];
+    if (!clipRect(dst, x, y, w, h, bounds)) return;
+
+    const int count = bounds[2] - bounds[0];
+    for (int row = bounds[1]; row < bounds[3]; row++) {
+        uint32_t* line = dst->pixels + (size_t)row * dst->stride + bounds[0];
+        for (int i = 0; i < count; i++) {
+            line[i] = color;
+        }
+    }
+}
+
+void Framebuffer_blendRect(Framebuffer* dst, int x, int y, int w, int h, uint32_t color) {
+    int bounds[4];
+    if (!clipRect(dst, x, y, w, h, bounds)) return;
+    Framebuffer_getSimd();
+
+    const int count = bounds[2] - bounds[0];
+    for (int row = bounds[1]; row < bounds[3]; row++) {
+        g_fillBlendRow(dst->pixels + (size_t)row * dst->stride + bounds[0], count, color);
+    }
+}
+
+static void blitSprite(const Framebuffer* src, Framebuffer* dst, int x, int y, int w, int h, uint32_t tint,
+                       SpriteRowFn drawRow) {
+    int bounds[4];
+    if (src->width <= 0 || src->height <= 0 || !clipRect(dst, x, y, w, h, bounds)) return;
+
+    const int count = bounds[2] - bounds[0];
+    const bool sameWidth = w == src->width;
+    if (!sameWidth) {
+        if (!reserveColumns(count) || !reserveLine(count)) return;
+        for (int i = 0; i < count; i++) {
+            g_columns[i] = (int32_t)((int64_t)(bounds[0] + i - x) * src->width / w);
+        }
+    }
+
+    for (int row = bounds[1]; row < bounds[3]; row++) {
+        const int sourceRow = h == src->height ? row - y : (int)((int64_t)(row - y) * src->height / h);
+        const uint32_t* sourceLine = src->pixels + (size_t)sourceRow * src->stride;
+        uint32_t* line = dst->pixels + (size_t)row * dst->stride + bounds[0];
+
+        if (sameWidth) {
+            drawRow(sourceLine + (bounds[0] - x), line, count, tint);
+        } else {
+            expandRow(sourceLine, g_line, g_columns, count);
+            drawRow(g_line, line, count, tint);
+        }
+    }
+}
+
+void Framebuffer_blitKeyed(const Framebuffer* src, Framebuffer* dst, int x, int y, int w, int h, uint32_t tint) {
+    Framebuffer_getSimd();
+    blitSprite(src, dst, x, y, w, h, tint, g_keyRow);
+}
+
+void Framebuffer_blitBlend(const Framebuffer* src, Framebuffer* dst, int x, int y, int w, int h, uint32_t tint) {
+    Framebuffer_getSimd();
+    blitSprite(src, dst, x, y, w, h, tint, g_blendRow);
+}
@@ -1,251 +1,37 @@
 #include "game.h"
-#include "render.h"
 #include "iomanager.h"
 #include "hud.h"
 #include "audio.h"
 #include "assets.h"
+#include "profiler.h"
+#include "trace.h"
+#include "flightrecorder.h"
+#include "renderstats.h"
+#include "loader.h"
+#include "startupreport.h"
+#include "text.h"
+#include "renderqueue.h"
+#include "visibility.h"
+#include "utils.h"
 
-#include <stdlib.h>
 #include <time.h>
 
-#define ENEMIES_PER_ZONE    5
-#define ENEMY_SPAWN_MIN_DISTANCE    4
-#define ENEMY_SPAWN_MAX_DISTANCE    10
-#define ENEMY_DESPAWN_DISTANCE      20
-
-static float absf(float value) {
-    return value < 0.0f ? -value : value;
-}
-
-static void getRandomPositionNearPlayer(const Map* map, const int playerPos[2], int outPos[2]) {
-    for (int attempts = 0; attempts < 100; attempts++) {
-        int offsetX = (rand() % (2 * ENEMY_SPAWN_MAX_DISTANCE + 1)) - ENEMY_SPAWN_MAX_DISTANCE;
-        int offsetY = (rand() % (2 * ENEMY_SPAWN_MAX_DISTANCE + 1)) - ENEMY_SPAWN_MAX_DISTANCE;
-
-        outPos[0] = playerPos[0] + offsetX;
-        outPos[1] = playerPos[1] + offsetY;
-
-        if (outPos[0] < 1 || outPos[0] >= GRID_WORLD_WIDTH - 1 ||
-            outPos[1] < 1 || outPos[1] >= GRID_WORLD_HEIGHT - 1) {
-            continue;
-        }
-
-        int dx = outPos[0] - playerPos[0];
-        int dy = outPos[1] - playerPos[1];
-        int distance = (dx > 0 ? dx : -dx) + (dy > 0 ? dy : -dy);
-
-        if (!Map_isBlocking(map, outPos) && distance >= ENEMY_SPAWN_MIN_DISTANCE) {
-            return;
-        }
-    }
-
-    outPos[0] = playerPos[0] + ENEMY_SPAWN_MIN_DISTANCE;
-    outPos[1] = playerPos[1];
-}
-
-static void spawnEnemiesNearPlayer(Game* game) {
-    for (int i = 0; i < game->enemyCount; i++) {
-        Enemy_destroy(&game->enemies[i]);
-    }
-    game->enemyCount = 0;
-
-    int playerPos[2];
-    Character_getGridPos(&game->player.base, playerPos);
-
-    for (int i = 0; i < ENEMIES_PER_ZONE && game->enemyCount < GAME_MAX_ENEMIES; i++) {
-        int spawnPos[2];
-        getRandomPositionNearPlayer(&game->map, playerPos, spawnPos);
-
-        EnemyType type;
-        EnemyAI ai;
-
-        switch (i % 3) {
-            case 0:
-                type = ENEMY_TYPE_BASIC;
-                ai = ENEMY_AI_RANDOM;
-                break;
-            case 1:
-                type = ENEMY_TYPE_FAST;
-                ai = ENEMY_AI_CHASE;
-                break;
-            case 2:
-                type = ENEMY_TYPE_TANK;
-                ai = ENEMY_AI_CHASE;
-                break;
-            default:
-                type = ENEMY_TYPE_BASIC;
-                ai = ENEMY_AI_RANDOM;
-                break;
-        }
-
-        Enemy_init(&game->enemies[game->enemyCount], type, ai, &game->map, spawnPos);
-        game->enemyCount++;
-    }
-}
-
-static void spawnSingleEnemy(Game* game) {
-    int slot = -1;
-
-    for (int i = 0; i < game->enemyCount; i++) {
-        if (!game->enemies[i].isActive) {
-            slot = i;
-            break;
-        }
-    }
-
-    if (slot == -1) {
-        if (game->enemyCount >= GAME_MAX_ENEMIES) return;
-        slot = game->enemyCount;
-        game->enemyCount++;
-    }
-
-    int spawnPos[2];
-    int playerPos[2];
-    Character_getGridPos(&game->player.base, playerPos);
-    getRandomPositionNearPlayer(&game->map, playerPos, spawnPos);
-
-    EnemyType type;
-    EnemyAI ai;
-    int r = rand() % 3;
-
-    switch (r) {
-        case 0:
-            type = ENEMY_TYPE_BASIC;
-            ai = ENEMY_AI_RANDOM;
-            break;
-        case 1:
-            type = ENEMY_TYPE_FAST;
-            ai = ENEMY_AI_CHASE;
-            break;
-        default:
-            type = ENEMY_TYPE_TANK;
-            ai = ENEMY_AI_CHASE;
-            break;
-    }
-
-    Enemy_init(&game->enemies[slot], type, ai, &game->map, spawnPos);
-}
-
-static void despawnDistantEnemies(Game* game) {
-    int playerPos[2];
-    Character_getGridPos(&game->player.base, playerPos);
-
-    for (int i = 0; i < game->enemyCount; i++) {
-        if (!game->enemies[i].isActive) continue;
-
-        int enemyPos[2];
-        Character_getGridPos(&game->enemies[i].base, enemyPos);
-
-        int dx = enemyPos[0] - playerPos[0];
-        int dy = enemyPos[1] - playerPos[1];
-        int distance = (dx > 0 ? dx : -dx) + (dy > 0 ? dy : -dy);
-
-        if (distance > ENEMY_DESPAWN_DISTANCE) {
-            game->enemies[i].isActive = false;
-        }
-    }
-}
-
-static void initGameplayResources(Game* game) {
-    srand((int)time(NULL));
-
-    Map_init(&game->map, game->render.renderer);
-
-    const int initialRoom[2] = GAME_INITIAL_ROOM;
-    game->map.currentRoom[0] = initialRoom[0];
-    game->map.currentRoom[1] = initialRoom[1];
-
-    Link_init(&game->player, &game->map);
-
-    int centerPos[2];
-    Room_getCenter(&game->map.rooms[initialRoom[1]][initialRoom[0]], centerPos);
-    game->player.base.posX = (float)centerPos[0];
-    game->player.base.posY = (float)centerPos[1];
-
-    Camera_followF(&game->map.camera, game->player.base.posX, game->player.base.posY);
-    game->map.camera.x = game->map.camera.targetX;
-    game->map.camera.y = game->map.camera.targetY;
-
-    spawnEnemiesNearPlayer(game);
-}
-
-static void resetPlayerStats(Game* game) {
-    game->stats.score = GAME_INITIAL_SCORE;
-    game->stats.kills = 0;
-    game->stats.playtime = 0;
-    game->stats.moves = 0;
-}
-
-static void checkEnemyCollisions(Game* game) {
-    int playerPos[2];
-    Character_getGridPos(&game->player.base, playerPos);
-
-    for (int i = 0; i < game->enemyCount; i++) {
-        if (!game->enemies[i].isActive) continue;
-
-        int livesBefore = game->player.base.lives;
-        if (Enemy_collidesWith(&game->enemies[i], playerPos)) {
-            Link_takeDamage(&game->player, 1);
-            if (game->player.base.lives < livesBefore) {
-                Audio_playSfx(AUDIO_SFX_PLAYER_HIT);
-            }
-        }
+static const char* stateName(GameState state) {
+    switch (state) {
+        case STATE_MENU:     return "menu";
+        case STATE_PLAYING:  return "playing";
+        case STATE_PAUSED:   return "paused";
+        case STATE_GAMEOVER: return "gameover";
+        case STATE_WIN:      return "win";
+        case STATE_LOADING:  return "loading";
     }
+    return "?";
 }
 
-static void handleAttack(Game* game) {
-    if (!Link_isAttacking(&game->player)) return;
-    if (game->player.attackCooldown < LINK_ATTACK_COOLDOWN - LINK_ATTACK_ACTIVE_TIME) return;
-
-    int attackPos[2];
-    Link_getAttackPosition(&game->player, attackPos);
-
-    int attackZone[3][2];
-    attackZone[0][0] = attackPos[0];
-    attackZone[0][1] = attackPos[1];
-
-    switch (game->player.direction) {
-        case LINK_DIR_UP:
-        case LINK_DIR_DOWN:
-            attackZone[1][0] = attackPos[0] - 1;
-            attackZone[1][1] = attackPos[1];
-            attackZone[2][0] = attackPos[0] + 1;
-            attackZone[2][1] = attackPos[1];
-            break;
-        case LINK_DIR_LEFT:
-        case LINK_DIR_RIGHT:
-            attackZone[1][0] = attackPos[0];
-            attackZone[1][1] = attackPos[1] - 1;
-            attackZone[2][0] = attackPos[0];
-            attackZone[2][1] = attackPos[1] + 1;
-            break;
-    }
-
-    for (int i = 0; i < game->enemyCount; i++) {
-        if (!game->enemies[i].isActive) continue;
-        if (game->enemies[i].hitTimer > 0) continue;
-
-        for (int z = 0; z < 3; z++) {
-            if (Enemy_collidesWith(&game->enemies[i], attackZone[z])) {
-                if (Enemy_takeDamage(&game->enemies[i], 1)) {
-                    game->stats.kills++;
-                    game->stats.score += ENEMY_KILL_SCORE;
-                    Audio_playSfx(AUDIO_SFX_ENEMY_KILLED);
-                }
-                break;
-            }
-        }
-    }
-}
-
-static int countActiveEnemies(const Game* game) {
-    int count = 0;
-    for (int i = 0; i < game->enemyCount; i++) {
-        if (game->enemies[i].isActive) {
-            count++;
-        }
-    }
-    return count;
+static void playWorldEvents(unsigned events) {
+    if (events & WORLD_EVENT_ATTACK) Audio_playSfx(AUDIO_SFX_ATTACK);
+    if (events & WORLD_EVENT_ENEMY_KILLED) Audio_playSfx(AUDIO_SFX_ENEMY_KILLED);
+    if (events & WORLD_EVENT_PLAYER_HIT) Audio_playSfx(AUDIO_SFX_PLAYER_HIT);
 }
 
 static void handlePlayingInput(Game* game, InputState* input, bool quit, bool pause) {
@@ -261,48 +47,14 @@ static void handlePlayingInput(Game* game, InputState* input, bool quit, bool pa
         return;
     }
 
-    int gridPos[2];
-    Character_getGridPos(&game->player.base, gridPos);
-    int oldPos[2] = {gridPos[0], gridPos[1]};
-    float oldX = game->player.base.posX;
-    float oldY = game->player.base.posY;
-
-    float deltaX = 0.0f;
-    float deltaY = 0.0f;
-
-    if (input->moveUp) deltaY -= MOVEMENT_SPEED;
-    if (input->moveDown) deltaY += MOVEMENT_SPEED;
-    if (input->moveLeft) deltaX -= MOVEMENT_SPEED;
-    if (input->moveRight) deltaX += MOVEMENT_SPEED;
-
-    if (deltaX != 0.0f && deltaY != 0.0f) {
-        const float diagonalFactor = 0.70710678f;
-        deltaX *= diagonalFactor;
-        deltaY *= diagonalFactor;
-    }
-
-    if (deltaX != 0.0f || deltaY != 0.0f) {
-        Link_moveSmooth(&game->player, deltaX, deltaY);
-    } else if (!Link_isAttacking(&game->player)) {
-        Animation_stop(&game->player.animation);
-    }
-
-    const bool isMoving = absf(game->player.base.posX - oldX) > 0.0001f ||
-                          absf(game->player.base.posY - oldY) > 0.0001f;
-    Audio_updateWalk(isMoving);
-
-    if (input->attack) {
-        const bool wasAttacking = Link_isAttacking(&game->player);
-        Link_attack(&game->player);
-        if (!wasAttacking && Link_isAttacking(&game->player)) {
-            Audio_playSfx(AUDIO_SFX_ATTACK);
-        }
+    if (input->toggleDebug) {
+        game->showDebug = !game->showDebug;
     }
 
-    Character_getGridPos(&game->player.base, gridPos);
-    if (oldPos[0] != gridPos[0] || oldPos[1] != gridPos[1]) {
-        game->stats.moves++;
-    }
+    World_beginTick(&game->world);
+    World_applyInput(&game->world, input);
+    Audio_updateWalk(game->world.playerMoving);
+    playWorldEvents(World_takeEvents(&game->world));
 }
 
 static void handleMenuAction(Game* game, MenuAction action) {
@@ -332,114 +84,309 @@ static void handleMenuAction(Game* game, MenuAction action) {
     }
 }
 
-static void drawAttackEffect(const Game* game) {
-    if (!Link_isAttacking(&game->player)) return;
-
-    int attackPos[2];
-    Link_getAttackPosition(&game->player, attackPos);
+static bool rendererHasVsync(SDL_Renderer* renderer) {
+    SDL_RendererInfo info;
+    if (SDL_GetRendererInfo(renderer, &info) != 0) return false;
+    return (info.flags & SDL_RENDERER_PRESENTVSYNC) != 0;
+}
 
-    int attackZone[3][2];
-    attackZone[0][0] = attackPos[0];
-    attackZone[0][1] = attackPos[1];
+static void waitForNextTick(Uint64 frameStart, Uint64 accumulator, Uint64 tickDuration, Uint64 frequency) {
+    const Uint64 spent = SDL_GetPerformanceCounter() - frameStart;
+    if (accumulator + spent >= tickDuration) return;
 
-    switch (game->player.direction) {
-        case LINK_DIR_UP:
-        case LINK_DIR_DOWN:
-            attackZone[1][0] = attackPos[0] - 1;
-            attackZone[1][1] = attackPos[1];
-            attackZone[2][0] = attackPos[0] + 1;
-            attackZone[2][1] = attackPos[1];
-            break;
-        case LINK_DIR_LEFT:
-        case LINK_DIR_RIGHT:
-            attackZone[1][0] = attackPos[0];
-            attackZone[1][1] = attackPos[1] - 1;
-            attackZone[2][0] = attackPos[0];
-            attackZone[2][1] = attackPos[1] + 1;
-            break;
+    const Uint64 remainingMs = (tickDuration - accumulator - spent) * 1000 / frequency;
+    if (remainingMs > 1) {
+        SDL_Delay((Uint32)(remainingMs - 1));
     }
+}
+
+static void drawAttackEffect(const Game* game, const Camera* view, const ViewRect* rect) {
+    if (!Link_isAttacking(&game->world.player)) return;
 
-    SDL_SetRenderDrawBlendMode(game->render.renderer, SDL_BLENDMODE_BLEND);
+    int attackZone[LINK_ATTACK_ZONE_SIZE][2];
+    Link_getAttackZone(&game->world.player, attackZone);
+
+    for (int z = 0; z < LINK_ATTACK_ZONE_SIZE; z++) {
+        if (!ViewRect_contains(rect, (float)attackZone[z][0], (float)attackZone[z][1])) continue;
 
-    for (int z = 0; z < 3; z++) {
         int screenPos[2];
-        Camera_worldToScreen(&game->map.camera, attackZone[z], screenPos);
+        Camera_worldToScreen(view, attackZone[z], screenPos);
 
-        int alpha = (z == 0) ? 180 : 100;
-        SDL_SetRenderDrawColor(game->render.renderer, 255, 220, 50, alpha);
+        Uint8 opacity = (z == 0) ? 180 : 100;
         SDL_Rect attackRect = {screenPos[0] + 3, screenPos[1] + 3, GRID_CELL_SIZE - 6, GRID_CELL_SIZE - 6};
-        SDL_RenderFillRect(game->render.renderer, &attackRect);
+        RenderQueue_fillRect(RENDER_LAYER_EFFECTS, &attackRect, (SDL_Color){255, 220, 50, opacity},
+                             SDL_BLENDMODE_BLEND);
+        RenderQueue_drawRect(RENDER_LAYER_EFFECTS, &attackRect, (SDL_Color){255, 150, 0, opacity},
+                             SDL_BLENDMODE_BLEND);
+    }
+}
 
-        SDL_SetRenderDrawColor(game->render.renderer, 255, 150, 0, alpha);
-        SDL_RenderDrawRect(game->render.renderer, &attackRect);
+static void drawEnemies(const Game* game, const Camera* view, const int* visible, int visibleCount, float alpha) {
+    for (int i = 0; i < visibleCount; i++) {
+        Scene_drawEnemy(&game->scene, &game->world.enemies[visible[i]], view, alpha);
     }
 }
 
-static void drawEnemies(const Game* game) {
-    for (int i = 0; i < game->enemyCount; i++) {
-        Enemy_draw(&game->enemies[i], game->render.renderer);
+static void drawPlayer(const Game* game, const Camera* view, const ViewRect* rect, float alpha) {
+    float renderPos[2];
+    Character_getRenderPos(&game->world.player.base, alpha, renderPos);
+    if (!ViewRect_contains(rect, renderPos[0], renderPos[1])) return;
+
+    Scene_drawLink(&game->scene, &game->world.player, view, alpha);
+}
+
+static void drawEntities(const Game* game, float alpha, bool withEffects) {
+    Camera view;
+    Camera_interpolate(&game->world.map.camera, alpha, &view);
+
+    ViewRect rect;
+    ViewRect_fromCamera(&view, &rect);
+
+    int visible[GAME_MAX_ENEMIES];
+    const int visibleCount = Visibility_collectEnemies(&rect, game->world.enemies, game->world.enemyCount,
+                                                       alpha, visible);
+
+    if (withEffects) drawAttackEffect(game, &view, &rect);
+    drawEnemies(game, &view, visible, visibleCount, alpha);
+    drawPlayer(game, &view, &rect, alpha);
+}
+
+static void printFrameReport(const Game* game) {
+    ProfileStats stats;
+    Profiler_getFrameStats(&stats);
+    printf("Frames : %d (%s), statistiques sur les %d dernieres\n", game->frameCount,
+           game->render.backend == RENDER_BACKEND_SOFTWARE ? "rendu logiciel" : "rendu GPU",
+           Profiler_frameCount());
+    printf("  %-12s moy %7.3f ms  p99 %7.3f ms  max %7.3f ms  (%.0f FPS)\n", "frame",
+           stats.avgMs, stats.p99Ms, stats.maxMs, stats.avgMs > 0.0f ? 1000.0f / stats.avgMs : 0.0f);
+
+    for (int zone = 0; zone < PROFILE_ZONE_COUNT; zone++) {
+        Profiler_getZoneStats((ProfileZone)zone, &stats);
+        printf("  %-12s moy %7.3f ms  p99 %7.3f ms  max %7.3f ms\n", Profiler_zoneName((ProfileZone)zone),
+               stats.avgMs, stats.p99Ms, stats.maxMs);
     }
 }
 
-static void drawPlayer(const Game* game) {
-    Link_draw(&game->player, game->render.renderer);
+static void saveRecording(Game* game) {
+    if (game->replayMode != REPLAY_MODE_RECORD || game->replay.count == 0) return;
+
+    if (Replay_save(&game->replay, game->replayPath)) {
+        printf("Replay enregistre : %s (%d ticks)\n", game->replayPath, game->replay.count);
+    }
+}
+
+static void stopPlayback(Game* game, const char* reason) {
+    printf("Replay %s apres %d ticks\n", reason, game->replay.cursor);
+    game->replayMode = REPLAY_MODE_OFF;
+    Game_setState(game, STATE_MENU);
+}
+
+static void readReplayInput(Game* game, InputState* input) {
+    if (game->replayMode != REPLAY_MODE_PLAYBACK) return;
+
+    if (!Replay_next(&game->replay, input, NULL)) {
+        stopPlayback(game, "termine");
+    }
+}
+
+static void trackReplayTick(Game* game) {
+    const uint32_t hash = World_hash(&game->world);
+
+    if (game->replayMode == REPLAY_MODE_RECORD) {
+        Replay_record(&game->replay, &game->tickInput, hash);
+    } else if (game->replayMode == REPLAY_MODE_PLAYBACK) {
+        const int tick = game->replay.cursor - 1;
+        if (hash != game->replay.hashes[tick]) {
+            fprintf(stderr, "Replay divergent au tick %d (attendu %08x, obtenu %08x)\n",
+                    tick, game->replay.hashes[tick], hash);
+            stopPlayback(game, "interrompu");
+        }
+    }
+}
+
+static bool initAssetsRoot(void) {
+    char* basePath = SDL_GetBasePath();
+    if (!basePath) {
+        fprintf(stderr, "Impossible de recuperer SDL_GetBasePath: %s\n", SDL_GetError());
+        return false;
+    }
+
+    const bool ready = assets_init(basePath);
+    SDL_free(basePath);
+    return ready;
+}
+
+static void finishLoading(Game* game) {
+    Trace_begin("finishLoading", "startup");
+    StartupReport_step("decodage parallele", game->loadStartNs);
+
+    uint64_t start = timeNowNs();
+    Scene_init(&game->scene, game->render.renderer);
+    StartupReport_step("Scene_init (upload)", start);
+
+    start = timeNowNs();
+    Audio_init(ASSET_AUDIO_CONFIG);
+    StartupReport_step("Audio_init", start);
+    Loader_shutdown();
+
+    Game_setState(game, STATE_MENU);
+    StartupReport_markReady();
+
+    if (game->replayMode == REPLAY_MODE_PLAYBACK) {
+        if (Replay_load(&game->replay, game->replayPath)) {
+            Game_startNewGame(game);
+        } else {
+            game->replayMode = REPLAY_MODE_OFF;
+        }
+    }
+    Trace_end("finishLoading", "startup");
 }
 
 void Game_init(Game* game) {
-    game->state = STATE_MENU;
-    game->previousState = STATE_MENU;
-    game->enemyCount = 0;
+    Trace_begin("Game_init", "startup");
+    game->state = STATE_LOADING;
+    game->previousState = STATE_LOADING;
+    game->world.enemyCount = 0;
     game->running = true;
-    resetPlayerStats(game);
 
+    uint64_t start = timeNowNs();
     initSDL();
-    if (!assets_init()) {
+    StartupReport_step("initSDL", start);
+
+    start = timeNowNs();
+    if (!initAssetsRoot()) {
         fprintf(stderr, "Impossible d'initialiser le resolver d'assets\n");
         game->running = false;
+        Trace_end("Game_init", "startup");
         return;
     }
+    StartupReport_step("assets_init", start);
+
+    start = timeNowNs();
     game->render.window = createWindow(WINDOW_TITLE, WINDOW_WIDTH, WINDOW_HEIGHT);
-    game->render.renderer = createRenderer(game->render.window);
-    game->render.font = TTF_OpenFont(asset_full(WINDOW_FONT_PATH), WINDOW_FONT_SIZE);
+    StartupReport_step("createWindow", start);
+
+    start = timeNowNs();
+    game->render.renderer = game->render.backend == RENDER_BACKEND_SOFTWARE
+                            ? createSoftwareRenderer(&game->render)
+                            : createRenderer(game->render.window);
+    setScaleMode(&game->render, game->render.scaleMode);
+    StartupReport_step("createRenderer", start);
+
+    start = timeNowNs();
+    game->render.font = TTF_OpenFontRW(openAssetRW(WINDOW_FONT_PATH), 1, WINDOW_FONT_SIZE);
+    StartupReport_step("TTF_OpenFont", start);
+    if (StartupReport_isEnabled()) {
+        StartupReport_addDecode(WINDOW_FONT_PATH, asset_size(WINDOW_FONT_PATH), timeNowNs() - start);
+    }
 
     if (game->render.font == NULL) {
         fprintf(stderr, "Erreur chargement police : %s\n", TTF_GetError());
+    } else {
+        start = timeNowNs();
+        Text_prepare(game->render.font, game->render.renderer);
+        StartupReport_step("Text_prepare (atlas de glyphes)", start);
     }
 
-    Audio_init(ASSET_AUDIO_CONFIG);
-    Audio_setMusicTrack(AUDIO_MUSIC_MENU);
-    Menu_initMain(&game->menu);
+    start = timeNowNs();
+    Audio_open(ASSET_AUDIO_CONFIG);
+    StartupReport_step("Audio_open", start);
+
+    game->loadStartNs = timeNowNs();
+    Scene_queueAssets();
+    Audio_queueLoads();
+    Loader_start();
+    Trace_end("Game_init", "startup");
 }
 
 void Game_run(Game* game) {
+    const Uint64 frequency = SDL_GetPerformanceFrequency();
+    const Uint64 tickDuration = frequency / GAME_TICK_RATE;
+    const Uint64 maxFrameTime = tickDuration * GAME_MAX_FRAME_TICKS;
+    const bool vsync = rendererHasVsync(game->render.renderer);
+
+    Uint64 previousCounter = SDL_GetPerformanceCounter();
+    Uint64 accumulator = 0;
+    Uint64 fpsStart = previousCounter;
+    int fpsFrames = 0;
+
     while (game->running) {
-        Game_handleInput(game);
-        Game_update(game);
-        Game_render(game);
-        SDL_Delay(16);
+        Profiler_beginFrame();
+        RenderStats_beginFrame();
+        const Uint64 frameStart = SDL_GetPerformanceCounter();
+        Uint64 frameTime = frameStart - previousCounter;
+        previousCounter = frameStart;
+
+        if (frameTime > maxFrameTime) {
+            frameTime = maxFrameTime;
+        }
+        accumulator += frameTime;
+
+        while (accumulator >= tickDuration && game->running) {
+            Profiler_begin(PROFILE_ZONE_INPUT);
+            Game_handleInput(game);
+            Profiler_end(PROFILE_ZONE_INPUT);
+
+            Profiler_begin(PROFILE_ZONE_UPDATE);
+            Game_update(game);
+            Profiler_end(PROFILE_ZONE_UPDATE);
+
+            accumulator -= tickDuration;
+        }
+
+        Game_render(game, (float)accumulator / (float)tickDuration);
+        StartupReport_markFrame();
+
+        const bool inWorld = game->state == STATE_PLAYING || game->state == STATE_PAUSED;
+        FlightRecorder_setEntityCount(inWorld ? World_countActiveEnemies(&game->world) + 1 : 0);
+        RenderStats_endFrame();
+        Profiler_endFrame();
+
+        fpsFrames++;
+        if (frameStart - fpsStart >= frequency) {
+            game->fps = fpsFrames;
+            fpsFrames = 0;
+            fpsStart = frameStart;
+        }
+
+        game->frameCount++;
+        if (game->frameLimit > 0 && game->frameCount >= game->frameLimit) {
+            game->running = false;
+        } else if (!vsync && game->frameLimit == 0) {
+            waitForNextTick(frameStart, accumulator, tickDuration, frequency);
+        }
+    }
+
+    if (game->frameLimit > 0) {
+        printFrameReport(game);
     }
 }
 
 void Game_destroy(Game* game) {
-    if (game->previousState == STATE_PLAYING || game->previousState == STATE_PAUSED ||
-        game->state == STATE_PLAYING || game->state == STATE_PAUSED ||
-        game->state == STATE_GAMEOVER || game->state == STATE_WIN) {
-        Link_destroy(&game->player);
-        Map_destroy(&game->map);
-    }
+    saveRecording(game);
+    Replay_free(&game->replay);
 
-    for (int i = 0; i < game->enemyCount; i++) {
-        Enemy_destroy(&game->enemies[i]);
-    }
+    Loader_shutdown();
+    Scene_destroy(&game->scene);
 
+    HUD_shutdown();
+    Text_shutdown();
+    RenderQueue_shutdown();
+    destroyWorldTarget(&game->render);
     if (game->render.font != NULL) {
         TTF_CloseFont(game->render.font);
     }
     Audio_shutdown();
+    if (game->screenshotPath) {
+        saveScreenshot(&game->render, game->screenshotPath);
+    }
     quitSDL(game->render.window, game->render.renderer);
+    destroyFramebuffer(&game->render);
+    assets_closeArchive();
 }
 
 void Game_setState(Game* game, GameState newState) {
+    Trace_beginDetail("Game_setState", "state", stateName(newState));
     game->previousState = game->state;
     game->state = newState;
 
@@ -457,14 +404,14 @@ void Game_setState(Game* game, GameState newState) {
             break;
 
         case STATE_GAMEOVER:
-            Menu_initGameOver(&game->menu, game->stats.score);
+            Menu_initGameOver(&game->menu, game->world.stats.score);
             Audio_updateWalk(false);
             Audio_playSfx(AUDIO_SFX_GAME_OVER);
             Audio_setMusicTrack(AUDIO_MUSIC_GAMEOVER);
             break;
 
         case STATE_WIN:
-            Menu_initWin(&game->menu, game->stats.score, GAME_WIN_KILLS);
+            Menu_initWin(&game->menu, game->world.stats.score, GAME_WIN_KILLS);
             Audio_updateWalk(false);
             Audio_setMusicTrack(AUDIO_MUSIC_GAMEOVER);
             break;
@@ -472,22 +419,25 @@ void Game_setState(Game* game, GameState newState) {
         case STATE_PLAYING:
             Audio_setMusicTrack(AUDIO_MUSIC_GAMEPLAY);
             break;
+
+        case STATE_LOADING:
+            break;
     }
+    Trace_end("Game_setState", "state");
 }
 
 void Game_startNewGame(Game* game) {
-    if (game->previousState == STATE_PLAYING || game->previousState == STATE_PAUSED ||
-        game->previousState == STATE_GAMEOVER || game->previousState == STATE_WIN) {
-        Link_destroy(&game->player);
-        Map_destroy(&game->map);
-        for (int i = 0; i < game->enemyCount; i++) {
-            Enemy_destroy(&game->enemies[i]);
-        }
-        game->enemyCount = 0;
+    unsigned seed = (unsigned)time(NULL);
+
+    if (game->replayMode == REPLAY_MODE_PLAYBACK) {
+        seed = game->replay.seed;
+        game->replay.cursor = 0;
+    } else if (game->replayMode == REPLAY_MODE_RECORD) {
+        saveRecording(game);
+        Replay_init(&game->replay, seed);
     }
 
-    resetPlayerStats(game);
-    initGameplayResources(game);
+    World_init(&game->world, seed);
 
     game->state = STATE_PLAYING;
     game->previousState = STATE_PLAYING;
@@ -509,6 +459,15 @@ void Game_resume(Game* game) {
 
 void Game_handleInput(Game* game) {
     switch (game->state) {
+        case STATE_LOADING: {
+            InputState inputState;
+            bool quit = false;
+            bool pause = false;
+            inputPollContinuous(&inputState, &quit, &pause);
+            if (quit) game->running = false;
+            break;
+        }
+
         case STATE_MENU:
         case STATE_PAUSED:
         case STATE_GAMEOVER:
@@ -523,6 +482,11 @@ void Game_handleInput(Game* game) {
             bool quit = false;
             bool pause = false;
             inputPollContinuous(&inputState, &quit, &pause);
+            if (!quit && !pause) {
+                readReplayInput(game, &inputState);
+                if (game->state != STATE_PLAYING) break;
+                game->tickInput = inputState;
+            }
             handlePlayingInput(game, &inputState, quit, pause);
             break;
         }
@@ -530,81 +494,97 @@ void Game_handleInput(Game* game) {
 }
 
 void Game_update(Game* game) {
-    if (game->state != STATE_PLAYING) {
-        return;
-    }
-
-    Link_update(&game->player);
-    handleAttack(game);
-
-    int playerPos[2];
-    Character_getGridPos(&game->player.base, playerPos);
-
-    Camera_followF(&game->map.camera, game->player.base.posX, game->player.base.posY);
-    Room_handleTransition(&game->map, playerPos);
-
-    despawnDistantEnemies(game);
-
-    int activeCount = countActiveEnemies(game);
-    if (activeCount < ENEMIES_PER_ZONE) {
-        int toSpawn = ENEMIES_PER_ZONE - activeCount;
-        for (int i = 0; i < toSpawn; i++) {
-            spawnSingleEnemy(game);
-        }
+    if (game->state == STATE_LOADING && Loader_isDone()) {
+        finishLoading(game);
     }
 
-    for (int i = 0; i < game->enemyCount; i++) {
-        if (game->enemies[i].isActive) {
-            Enemy_update(&game->enemies[i], playerPos, game->enemies, game->enemyCount, i);
-        }
+    if (game->state != STATE_PLAYING) {
+        return;
     }
 
-    checkEnemyCollisions(game);
-    game->stats.playtime++;
+    const WorldOutcome outcome = World_update(&game->world);
+    playWorldEvents(World_takeEvents(&game->world));
+    trackReplayTick(game);
+    if (game->state != STATE_PLAYING) return;
 
-    if (game->player.base.lives <= 0) {
+    if (outcome == WORLD_OUTCOME_DEFEAT) {
         Game_setState(game, STATE_GAMEOVER);
-    } else if (game->stats.kills >= GAME_WIN_KILLS) {
+    } else if (outcome == WORLD_OUTCOME_VICTORY) {
         Game_setState(game, STATE_WIN);
     }
 }
 
-void Game_render(Game* game) {
+void Game_render(Game* game, float alpha) {
     switch (game->state) {
+        case STATE_LOADING:
+            RenderStats_setPass(RENDER_PASS_MENU);
+            HUD_renderLoading(&game->render, Loader_completed(), Loader_total());
+            updateDisplay(&game->render);
+            break;
+
         case STATE_MENU:
         case STATE_GAMEOVER:
         case STATE_WIN:
+            RenderStats_setPass(RENDER_PASS_MENU);
             Menu_render(&game->menu, &game->render);
             break;
 
         case STATE_PAUSED: {
+            RenderStats_setPass(RENDER_PASS_MAP);
             SDL_SetRenderDrawColor(game->render.renderer, 0, 0, 0, 255);
             clearRenderer(game->render.renderer);
-            Map_draw(&game->map, false);
-            drawEnemies(game);
-            drawPlayer(game);
+            beginWorldPass(&game->render);
+            Scene_drawMap(&game->scene, &game->world.map, false, 1.0f);
+
+            RenderQueue_begin(game->render.renderer);
+            RenderStats_setPass(RENDER_PASS_ENTITIES);
+            drawEntities(game, 1.0f, false);
+            RenderQueue_flush();
+            endWorldPass(&game->render);
 
-            SDL_SetRenderDrawBlendMode(game->render.renderer, SDL_BLENDMODE_BLEND);
-            SDL_SetRenderDrawColor(game->render.renderer, 0, 0, 0, 180);
+            RenderStats_setPass(RENDER_PASS_MENU);
+            RenderQueue_begin(game->render.renderer);
             SDL_Rect overlay = {0, 0, WINDOW_WIDTH, WINDOW_HEIGHT};
-            SDL_RenderFillRect(game->render.renderer, &overlay);
+            RenderQueue_fillRect(RENDER_LAYER_OVERLAY, &overlay, (SDL_Color){0, 0, 0, 180}, SDL_BLENDMODE_BLEND);
+            RenderQueue_flush();
 
             Menu_render(&game->menu, &game->render);
             break;
         }
 
         case STATE_PLAYING:
+            RenderStats_setPass(RENDER_PASS_MAP);
             SDL_SetRenderDrawColor(game->render.renderer, 0, 0, 0, 255);
             clearRenderer(game->render.renderer);
 
-            Map_draw(&game->map, false);
-            drawAttackEffect(game);
-            drawEnemies(game);
-            drawPlayer(game);
-
-            HUD_render(&game->render, &game->stats, game->player.base.lives, game->map.currentRoom);
+            Profiler_begin(PROFILE_ZONE_MAP);
+            beginWorldPass(&game->render);
+            Scene_drawMap(&game->scene, &game->world.map, false, alpha);
+            Profiler_end(PROFILE_ZONE_MAP);
+
+            RenderStats_setPass(RENDER_PASS_ENTITIES);
+            Profiler_begin(PROFILE_ZONE_ENTITIES);
+            RenderQueue_begin(game->render.renderer);
+            drawEntities(game, alpha, true);
+            RenderQueue_flush();
+            Profiler_end(PROFILE_ZONE_ENTITIES);
+
+            RenderStats_setPass(RENDER_PASS_MAP);
+            endWorldPass(&game->render);
+
+            RenderStats_setPass(RENDER_PASS_HUD);
+            Profiler_begin(PROFILE_ZONE_HUD);
+            HUD_render(&game->render, &game->world.stats, game->world.player.base.lives, game->world.map.currentRoom);
+            Profiler_end(PROFILE_ZONE_HUD);
+
+            if (game->showDebug) {
+                RenderStats_setPass(RENDER_PASS_DEBUG);
+                HUD_renderDebugInfo(&game->render, game->fps, World_countActiveEnemies(&game->world) + 1);
+            }
 
-            updateDisplay(game->render.renderer);
+            Profiler_begin(PROFILE_ZONE_PRESENT);
+            updateDisplay(&game->render);
+            Profiler_end(PROFILE_ZONE_PRESENT);
             break;
     }
 }
@@ -0,0 +1,300 @@
+#include "world.h"
+#include "replay.h"
+#include "trace.h"
+#include "hwcounters.h"
+#include "assets.h"
+#include "utils.h"
+
+#include <ctype.h>
+
+#define SCRIPT_MAX_STEPS    256
+#define DEFAULT_TICKS       100000
+#define DEFAULT_SEED        1
+
+typedef struct {
+    int        ticks;
+    InputState input;
+} ScriptStep;
+
+typedef struct {
+    ScriptStep steps[SCRIPT_MAX_STEPS];
+    int        count;
+    int        current;
+    int        remaining;
+} InputScript;
+
+typedef struct {
+    long        ticks;
+    unsigned    seed;
+    const char* scriptPath;
+    const char* recordPath;
+    const char* replayPath;
+    const char* tracePath;
+    bool        hwCounters;
+} HeadlessOptions;
+
+static const char* DEFAULT_SCRIPT[] = {
+    "90 R",
+    "60 D",
+    "40 LA",
+    "90 U",
+    "30 A",
+    "60 RD",
+    "45 L",
+    "20 -",
+    "60 UL",
+    "30 DA"
+};
+
+static void usage(const char* program) {
+    fprintf(stderr, "Usage : %s [--ticks N] [--seed S] [--script FICHIER] [--trace FICHIER.json] [--hw-counters]\n", program);
+    fprintf(stderr, "       %s --record FICHIER [--ticks N] [--seed S] [--script FICHIER]\n", program);
+    fprintf(stderr, "       %s --replay FICHIER\n", program);
+    fprintf(stderr, "  Script : une etape par ligne, \"<ticks> <touches>\" avec U D L R A I ou -\n");
+}
+
+static bool parseStep(const char* line, ScriptStep* step) {
+    char keys[32] = "";
+    if (sscanf(line, "%d %31s", &step->ticks, keys) < 1 || step->ticks <= 0) {
+        return false;
+    }
+
+    memset(&step->input, 0, sizeof(step->input));
+    for (const char* k = keys; *k != '\0'; k++) {
+        switch (toupper((unsigned char)*k)) {
+            case 'U': step->input.moveUp = true; break;
+            case 'D': step->input.moveDown = true; break;
+            case 'L': step->input.moveLeft = true; break;
+            case 'R': step->input.moveRight = true; break;
+            case 'A': step->input.attack = true; break;
+            case 'I': step->input.interact = true; break;
+            case '-': break;
+            default:  return false;
+        }
+    }
+    return true;
+}
+
+static void addStep(InputScript* script, const char* line) {
+    if (script->count >= SCRIPT_MAX_STEPS) return;
+
+    ScriptStep step;
+    if (parseStep(line, &step)) {
+        script->steps[script->count++] = step;
+    }
+}
+
+static bool loadScript(InputScript* script, const char* path) {
+    memset(script, 0, sizeof(*script));
+
+    if (!path) {
+        const int lines = (int)(sizeof(DEFAULT_SCRIPT) / sizeof(DEFAULT_SCRIPT[0]));
+        for (int i = 0; i < lines; i++) {
+            addStep(script, DEFAULT_SCRIPT[i]);
+        }
+    } else {
+        FILE* file = fopen(path, "r");
+        if (!file) {
+            fprintf(stderr, "Script introuvable : %s\n", path);
+            return false;
+        }
+
+        char line[128];
+        while (fgets(line, sizeof(line), file)) {
+            if (line[0] == '#' || line[0] == '\n') continue;
+            addStep(script, line);
+        }
+        fclose(file);
+    }
+
+    if (script->count == 0) {
+        fprintf(stderr, "Script vide\n");
+        return false;
+    }
+
+    script->remaining = script->steps[0].ticks;
+    return true;
+}
+
+static const InputState* nextInput(InputScript* script) {
+    if (script->remaining <= 0) {
+        script->current = (script->current + 1) % script->count;
+        script->remaining = script->steps[script->current].ticks;
+    }
+    script->remaining--;
+    return &script->steps[script->current].input;
+}
+
+static bool parseOptions(int argc, char* argv[], HeadlessOptions* options) {
+    options->ticks = DEFAULT_TICKS;
+    options->seed = DEFAULT_SEED;
+    options->scriptPath = NULL;
+    options->recordPath = NULL;
+    options->replayPath = NULL;
+    options->tracePath = NULL;
+    options->hwCounters = false;
+
+    for (int i = 1; i < argc; i++) {
+        const bool hasValue = i + 1 < argc;
+
+        if (strcmp(argv[i], "--ticks") == 0 && hasValue) {
+            options->ticks = strtol(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--seed") == 0 && hasValue) {
+            options->seed = (unsigned)strtoul(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--script") == 0 && hasValue) {
+            options->scriptPath = argv[++i];
+        } else if (strcmp(argv[i], "--record") == 0 && hasValue) {
+            options->recordPath = argv[++i];
+        } else if (strcmp(argv[i], "--replay") == 0 && hasValue) {
+            options->replayPath = argv[++i];
+        } else if (strcmp(argv[i], "--trace") == 0 && hasValue) {
+            options->tracePath = argv[++i];
+        } else if (strcmp(argv[i], "--hw-counters") == 0) {
+            options->hwCounters = true;
+        } else {
+            return false;
+        }
+    }
+
+    return options->ticks > 0;
+}
+
+static int runReplay(const char* path) {
+    Replay replay = {0};
+    if (!Replay_load(&replay, path)) {
+        Replay_free(&replay);
+        return EXIT_FAILURE;
+    }
+
+    static World world;
+    World_init(&world, replay.seed);
+
+    InputState input;
+    uint32_t expected;
+    int divergence = -1;
+
+    while (Replay_next(&replay, &input, &expected)) {
+        World_beginTick(&world);
+        World_applyInput(&world, &input);
+        World_update(&world);
+        World_takeEvents(&world);
+
+        const uint32_t actual = World_hash(&world);
+        if (actual != expected) {
+            divergence = replay.cursor - 1;
+            printf("divergence   : tick %d (attendu %08x, obtenu %08x)\n", divergence, expected, actual);
+            break;
+        }
+    }
+
+    printf("replay       : %s (graine %u, %d ticks)\n", path, replay.seed, replay.count);
+    printf("resultat     : %s\n", divergence < 0 ? "identique" : "divergent");
+
+    Replay_free(&replay);
+    return divergence < 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+static int runRecord(const HeadlessOptions* options, InputScript* script) {
+    static World world;
+    World_init(&world, options->seed);
+
+    Replay replay = {0};
+    Replay_init(&replay, options->seed);
+
+    WorldOutcome outcome = WORLD_OUTCOME_RUNNING;
+    for (long tick = 0; tick < options->ticks && outcome == WORLD_OUTCOME_RUNNING; tick++) {
+        const InputState* input = nextInput(script);
+        World_beginTick(&world);
+        World_applyInput(&world, input);
+        outcome = World_update(&world);
+        World_takeEvents(&world);
+
+        if (!Replay_record(&replay, input, World_hash(&world))) break;
+    }
+
+    const bool saved = Replay_save(&replay, options->recordPath);
+    if (saved) {
+        printf("replay       : %s (graine %u, %d ticks)\n", options->recordPath, replay.seed, replay.count);
+    }
+
+    Replay_free(&replay);
+    return saved ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+int main(int argc, char* argv[]) {
+    HeadlessOptions options;
+    if (!parseOptions(argc, argv, &options)) {
+        usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    if (!assets_initFromExecutable(argv[0])) {
+        fprintf(stderr, "Impossible d'initialiser le resolver d'assets\n");
+        return EXIT_FAILURE;
+    }
+
+    if (options.replayPath) {
+        return runReplay(options.replayPath);
+    }
+
+    InputScript script;
+    if (!loadScript(&script, options.scriptPath)) {
+        return EXIT_FAILURE;
+    }
+
+    if (options.recordPath) {
+        return runRecord(&options, &script);
+    }
+
+    static World world;
+    World_init(&world, options.seed);
+
+    int games = 1;
+    int defeats = 0;
+    int victories = 0;
+    long totalKills = 0;
+
+    if (options.tracePath && !Trace_start(options.tracePath)) {
+        return EXIT_FAILURE;
+    }
+
+    if (options.hwCounters) {
+        HwCounters_init();
+    }
+
+    const uint64_t start = timeNowNs();
+
+    for (long tick = 0; tick < options.ticks; tick++) {
+        World_beginTick(&world);
+        World_applyInput(&world, nextInput(&script));
+        const WorldOutcome outcome = World_update(&world);
+        World_takeEvents(&world);
+
+        if (outcome != WORLD_OUTCOME_RUNNING) {
+            if (outcome == WORLD_OUTCOME_DEFEAT) defeats++;
+            else victories++;
+
+            totalKills += world.stats.kills;
+            World_init(&world, options.seed + (unsigned)games);
+            games++;
+        }
+    }
+
+    const uint64_t elapsed = timeNowNs() - start;
+    Trace_stop();
+    const double seconds = (double)elapsed / 1e9;
+    totalKills += world.stats.kills;
+
+    printf("ticks        : %ld\n", options.ticks);
+    printf("duree        : %.3f s\n", seconds);
+    printf("ticks/s      : %.0f\n", seconds > 0.0 ? (double)options.ticks / seconds : 0.0);
+    printf("ns/tick      : %.1f\n", (double)elapsed / (double)options.ticks);
+    printf("parties      : %d (%d defaites, %d victoires)\n", games, defeats, victories);
+    printf("kills        : %ld\n", totalKills);
+    printf("ennemis      : %d actifs\n", World_countActiveEnemies(&world));
+
+    HwCounters_printReport(stdout);
+    HwCounters_shutdown();
+
+    return EXIT_SUCCESS;
+}
@@ -1,28 +1,67 @@
 #include "hud.h"
 #include "render.h"
+#include "text.h"
 #include <string.h>
 
 static char s_messageBuffer[128] = "";
 static int  s_messageTimer = 0;
 
+typedef enum {
+    HUD_FIELD_LIVES,
+    HUD_FIELD_SCORE,
+    HUD_FIELD_KILLS,
+    HUD_FIELD_TIME,
+    HUD_FIELD_ROOM,
+    HUD_FIELD_MOVES,
+    HUD_FIELD_OBJECTIVE,
+    HUD_FIELD_COUNT
+} HUDField;
+
+typedef struct {
+    int x;
+    int line;
+    int width;
+} HUDFieldLayout;
+
+typedef struct {
+    char text[HUD_FIELD_COUNT][HUD_FIELD_TEXT_SIZE];
+    int  lives;
+} HUDValues;
+
+static const HUDFieldLayout HUD_FIELDS[HUD_FIELD_COUNT] = {
+    [HUD_FIELD_LIVES]     = {HUD_MARGIN_LEFT, 0, HUD_COLUMN_2_X - HUD_MARGIN_LEFT},
+    [HUD_FIELD_SCORE]     = {HUD_MARGIN_LEFT, 1, HUD_COLUMN_2_X - HUD_MARGIN_LEFT},
+    [HUD_FIELD_KILLS]     = {HUD_COLUMN_2_X,  0, HUD_COLUMN_3_X - HUD_COLUMN_2_X},
+    [HUD_FIELD_TIME]      = {HUD_COLUMN_2_X,  1, HUD_COLUMN_3_X - HUD_COLUMN_2_X},
+    [HUD_FIELD_ROOM]      = {HUD_COLUMN_3_X,  0, HUD_CONTROLS_X - HUD_COLUMN_3_X},
+    [HUD_FIELD_MOVES]     = {HUD_COLUMN_3_X,  1, HUD_CONTROLS_X - HUD_COLUMN_3_X},
+    [HUD_FIELD_OBJECTIVE] = {HUD_COLUMN_2_X,  2, HUD_COLUMN_3_X - HUD_COLUMN_2_X}
+};
+
+static SDL_Texture*  s_hudTexture = NULL;
+static SDL_Renderer* s_hudRenderer = NULL;
+static TTF_Font*     s_hudFont = NULL;
+static HUDValues     s_hudValues;
+static HUDConfig     s_hudConfig;
+static bool          s_hudValid = false;
+static bool          s_hudUnsupported = false;
+static bool          s_hudTargetsLost = false;
+
 static int getHudYPosition(void) {
     return WINDOW_HEIGHT - WINDOW_TEXTAREA_HEIGHT;
 }
 
-static void renderHudBackground(SDL_Renderer* renderer, const SDL_Color* bgColor) {
-    const int hudY = getHudYPosition();
+static void renderHudBackground(SDL_Renderer* renderer, int hudY, const SDL_Color* bgColor) {
     SDL_Rect hudBackground = {0, hudY, WINDOW_WIDTH, WINDOW_TEXTAREA_HEIGHT};
     SDL_SetRenderDrawColor(renderer, bgColor->r, bgColor->g, bgColor->b, bgColor->a);
-    SDL_RenderFillRect(renderer, &hudBackground);
+    renderFillRect(renderer, &hudBackground);
 }
 
-static void renderHudSeparator(SDL_Renderer* renderer, const SDL_Color* separatorColor) {
-    const int hudY = getHudYPosition();
+static void renderHudSeparator(SDL_Renderer* renderer, int hudY, const SDL_Color* separatorColor) {
     SDL_SetRenderDrawColor(renderer, separatorColor->r, separatorColor->g,
                           separatorColor->b, separatorColor->a);
-    SDL_RenderDrawLine(renderer, 0, hudY, WINDOW_WIDTH, hudY);
+    renderDrawLine(renderer, 0, hudY, WINDOW_WIDTH, hudY);
 }
-
 static void drawKey(SDL_Renderer* renderer, TTF_Font* font, int x, int y,
                     const char* key, bool highlight) {
     const int keySize = 22;
@@ -30,30 +69,20 @@ static void drawKey(SDL_Renderer* renderer, TTF_Font* font, int x, int y,
     SDL_Color bgColor = highlight ? (SDL_Color){100, 150, 255, 255} : (SDL_Color){60, 60, 70, 255};
     SDL_SetRenderDrawColor(renderer, bgColor.r, bgColor.g, bgColor.b, bgColor.a);
     SDL_Rect keyRect = {x, y, keySize, keySize};
-    SDL_RenderFillRect(renderer, &keyRect);
+    renderFillRect(renderer, &keyRect);
 
     SDL_SetRenderDrawColor(renderer, 120, 120, 130, 255);
-    SDL_RenderDrawRect(renderer, &keyRect);
+    renderDrawRect(renderer, &keyRect);
 
     SDL_SetRenderDrawColor(renderer, 90, 90, 100, 255);
-    SDL_RenderDrawLine(renderer, x + 1, y + 1, x + keySize - 2, y + 1);
+    renderDrawLine(renderer, x + 1, y + 1, x + keySize - 2, y + 1);
 
     if (font && key) {
         SDL_Color textColor = {255, 255, 255, 255};
-        SDL_Surface* surface = TTF_RenderText_Solid(font, key, textColor);
-        if (surface) {
-            SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
-            if (texture) {
-                SDL_Rect textRect = {
-                    x + (keySize - surface->w) / 2,
-                    y + (keySize - surface->h) / 2,
-                    surface->w, surface->h
-                };
-                SDL_RenderCopy(renderer, texture, NULL, &textRect);
-                SDL_DestroyTexture(texture);
-            }
-            SDL_FreeSurface(surface);
-        }
+        int textWidth, textHeight;
+        Text_size(font, key, &textWidth, &textHeight);
+        Text_draw(renderer, font, x + (keySize - textWidth) / 2, y + (keySize - textHeight) / 2,
+                  key, textColor);
     }
 }
 
@@ -73,18 +102,7 @@ static void drawControls(SDL_Renderer* renderer, TTF_Font* font, int startX, int
     drawKey(renderer, font, startX + keySize + spacing + 5, row3Y, "P", false);
 
     SDL_Color labelColor = {150, 150, 150, 255};
-    if (font) {
-        SDL_Surface* surface = TTF_RenderText_Solid(font, "ATK", labelColor);
-        if (surface) {
-            SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
-            if (texture) {
-                SDL_Rect rect = {startX + (keySize + spacing) * 2 + 15, row3Y + 3, surface->w, surface->h};
-                SDL_RenderCopy(renderer, texture, NULL, &rect);
-                SDL_DestroyTexture(texture);
-            }
-            SDL_FreeSurface(surface);
-        }
-    }
+    Text_draw(renderer, font, startX + (keySize + spacing) * 2 + 15, row3Y + 3, "ATK", labelColor);
 }
 
 void HUD_initConfig(HUDConfig* config) {
@@ -105,75 +123,326 @@ void HUD_render(const RenderState* render, const PlayerStats* stats, int lives,
     HUD_renderWithConfig(render, stats, lives, currentRoom, &config);
 }
 
-void HUD_renderWithConfig(const RenderState* render, const PlayerStats* stats,
-                          int lives, const int currentRoom[2], const HUDConfig* config) {
-    if (!render || !stats || !currentRoom || !config) return;
-
-    const int hudY = getHudYPosition();
-    const int lineSpacing = config->lineSpacing;
-
-    renderHudBackground(render->renderer, &config->backgroundColor);
-
-    renderHudSeparator(render->renderer, &config->separatorColor);
-
-    char buffer[64];
-
+static void drawHearts(SDL_Renderer* renderer, int x, int y, int lives) {
     for (int i = 0; i < GAME_INITIAL_LIVES; i++) {
-        int heartX = HUD_MARGIN_LEFT + i * 25;
-        int heartY = hudY + HUD_MARGIN_TOP;
+        int heartX = x + i * 25;
+        int heartY = y;
 
         if (i < lives) {
-            SDL_SetRenderDrawColor(render->renderer, 255, 50, 50, 255);
+            SDL_SetRenderDrawColor(renderer, 255, 50, 50, 255);
         } else {
-            SDL_SetRenderDrawColor(render->renderer, 80, 80, 80, 255);
+            SDL_SetRenderDrawColor(renderer, 80, 80, 80, 255);
         }
 
         SDL_Rect heart1 = {heartX, heartY + 3, 8, 8};
         SDL_Rect heart2 = {heartX + 8, heartY + 3, 8, 8};
-        SDL_RenderFillRect(render->renderer, &heart1);
-        SDL_RenderFillRect(render->renderer, &heart2);
+        renderFillRect(renderer, &heart1);
+        renderFillRect(renderer, &heart2);
 
         for (int j = 0; j < 8; j++) {
-            SDL_RenderDrawLine(render->renderer,
+            renderDrawLine(renderer,
                 heartX + j, heartY + 11 + j / 2,
                 heartX + 16 - j, heartY + 11 + j / 2);
         }
     }
+}
 
-    snprintf(buffer, sizeof(buffer), "Score : %d", stats->score);
-    printTextWithFont(HUD_MARGIN_LEFT, hudY + HUD_MARGIN_TOP + lineSpacing, buffer, render->font, render->renderer);
+static void formatValues(HUDValues* values, const PlayerStats* stats, int lives, const int currentRoom[2]) {
+    const int seconds = stats->playtime / GAME_TICK_RATE;
+
+    values->lives = lives;
+    snprintf(values->text[HUD_FIELD_LIVES], HUD_FIELD_TEXT_SIZE, "%d", lives);
+    snprintf(values->text[HUD_FIELD_SCORE], HUD_FIELD_TEXT_SIZE, "Score : %d", stats->score);
+    snprintf(values->text[HUD_FIELD_KILLS], HUD_FIELD_TEXT_SIZE, "Kills : %d", stats->kills);
+    snprintf(values->text[HUD_FIELD_TIME], HUD_FIELD_TEXT_SIZE, "Temps : %02d:%02d", seconds / 60, seconds % 60);
+    snprintf(values->text[HUD_FIELD_ROOM], HUD_FIELD_TEXT_SIZE, "Salle : [%d, %d]", currentRoom[0], currentRoom[1]);
+    snprintf(values->text[HUD_FIELD_MOVES], HUD_FIELD_TEXT_SIZE, "Mouvements : %d", stats->moves);
+    snprintf(values->text[HUD_FIELD_OBJECTIVE], HUD_FIELD_TEXT_SIZE, "Objectif : %d/%d",
+             stats->kills, GAME_WIN_KILLS);
+}
+
+static void drawField(const RenderState* render, int hudY, HUDField field, const HUDValues* values,
+                      const HUDConfig* config, bool clear) {
+    const HUDFieldLayout* layout = &HUD_FIELDS[field];
+    const int y = hudY + HUD_MARGIN_TOP + layout->line * config->lineSpacing;
 
-    snprintf(buffer, sizeof(buffer), "Kills : %d", stats->kills);
-    printTextWithFont(HUD_COLUMN_2_X, hudY + HUD_MARGIN_TOP, buffer, render->font, render->renderer);
+    if (clear) {
+        const SDL_Color* bg = &config->backgroundColor;
+        SDL_SetRenderDrawColor(render->renderer, bg->r, bg->g, bg->b, bg->a);
+        SDL_Rect area = {layout->x, y, layout->width, config->lineSpacing};
+        renderFillRect(render->renderer, &area);
+    }
 
-    const int seconds = stats->playtime / 60;
-    snprintf(buffer, sizeof(buffer), "Temps : %02d:%02d", seconds / 60, seconds % 60);
-    printTextWithFont(HUD_COLUMN_2_X, hudY + HUD_MARGIN_TOP + lineSpacing, buffer, render->font, render->renderer);
+    if (field == HUD_FIELD_LIVES) {
+        drawHearts(render->renderer, layout->x, y, values->lives);
+    } else {
+        printTextWithFont(layout->x, y, values->text[field], render->font, render->renderer);
+    }
+}
 
-    snprintf(buffer, sizeof(buffer), "Salle : [%d, %d]", currentRoom[0], currentRoom[1]);
-    printTextWithFont(HUD_COLUMN_3_X, hudY + HUD_MARGIN_TOP, buffer, render->font, render->renderer);
+static void drawHud(const RenderState* render, int hudY, const HUDValues* values, const HUDConfig* config) {
+    renderHudBackground(render->renderer, hudY, &config->backgroundColor);
 
-    snprintf(buffer, sizeof(buffer), "Mouvements : %d", stats->moves);
-    printTextWithFont(HUD_COLUMN_3_X, hudY + HUD_MARGIN_TOP + lineSpacing, buffer, render->font, render->renderer);
+    renderHudSeparator(render->renderer, hudY, &config->separatorColor);
 
-    snprintf(buffer, sizeof(buffer), "Objectif : %d/%d", stats->kills, GAME_WIN_KILLS);
-    printTextWithFont(HUD_COLUMN_2_X, hudY + HUD_MARGIN_TOP + 2 * lineSpacing, buffer, render->font, render->renderer);
+    for (int field = 0; field < HUD_FIELD_COUNT; field++) {
+        drawField(render, hudY, (HUDField)field, values, config, false);
+    }
 
     drawControls(render->renderer, render->font, HUD_CONTROLS_X, hudY + HUD_MARGIN_TOP);
 }
 
+static bool sameConfig(const HUDConfig* a, const HUDConfig* b) {
+    const SDL_Color* colorsA[2] = {&a->backgroundColor, &a->separatorColor};
+    const SDL_Color* colorsB[2] = {&b->backgroundColor, &b->separatorColor};
+    for (int i = 0; i < 2; i++) {
+        if (colorsA[i]->r != colorsB[i]->r || colorsA[i]->g != colorsB[i]->g ||
+            colorsA[i]->b != colorsB[i]->b || colorsA[i]->a != colorsB[i]->a) {
+            return false;
+        }
+    }
+    return a->lineSpacing == b->lineSpacing;
+}
+
+static int onRenderReset(void* userdata, SDL_Event* event) {
+    (void)userdata;
+    if (event->type == SDL_RENDER_TARGETS_RESET || event->type == SDL_RENDER_DEVICE_RESET) {
+        s_hudTargetsLost = true;
+    }
+    return 1;
+}
+
+static bool ensureHudTexture(SDL_Renderer* renderer) {
+    if (s_hudTargetsLost || (s_hudTexture != NULL && s_hudRenderer != renderer)) {
+        HUD_shutdown();
+    }
+    if (s_hudTexture != NULL) return true;
+    if (s_hudUnsupported || !SDL_RenderTargetSupported(renderer)) {
+        s_hudUnsupported = true;
+        return false;
+    }
+
+    s_hudTexture = renderCreateTargetTexture(renderer, WINDOW_WIDTH, HUD_HEIGHT);
+    if (s_hudTexture == NULL) {
+        s_hudUnsupported = true;
+        return false;
+    }
+
+    SDL_SetTextureBlendMode(s_hudTexture, SDL_BLENDMODE_BLEND);
+    SDL_AddEventWatch(onRenderReset, NULL);
+    s_hudRenderer = renderer;
+    s_hudValid = false;
+    return true;
+}
+
+static bool updateHudTexture(const RenderState* render, const HUDValues* values, const HUDConfig* config) {
+    if (!ensureHudTexture(render->renderer)) return false;
+
+    const bool rebuild = !s_hudValid || s_hudFont != render->font || !sameConfig(&s_hudConfig, config);
+    bool dirty[HUD_FIELD_COUNT];
+    bool anyDirty = rebuild;
+    for (int field = 0; field < HUD_FIELD_COUNT; field++) {
+        dirty[field] = strcmp(s_hudValues.text[field], values->text[field]) != 0;
+        anyDirty = anyDirty || dirty[field];
+    }
+    if (!anyDirty) return true;
+
+    SDL_Texture* previous = SDL_GetRenderTarget(render->renderer);
+    if (SDL_SetRenderTarget(render->renderer, s_hudTexture) != 0) {
+        s_hudUnsupported = true;
+        HUD_shutdown();
+        return false;
+    }
+
+    if (rebuild) {
+        drawHud(render, 0, values, config);
+    } else {
+        for (int field = 0; field < HUD_FIELD_COUNT; field++) {
+            if (dirty[field]) drawField(render, 0, (HUDField)field, values, config, true);
+        }
+    }
+
+    SDL_SetRenderTarget(render->renderer, previous);
+
+    s_hudValues = *values;
+    s_hudConfig = *config;
+    s_hudFont = render->font;
+    s_hudValid = true;
+    return true;
+}
+
+void HUD_renderWithConfig(const RenderState* render, const PlayerStats* stats,
+                          int lives, const int currentRoom[2], const HUDConfig* config) {
+    if (!render || !stats || !currentRoom || !config) return;
+
+    HUDValues values;
+    formatValues(&values, stats, lives, currentRoom);
+
+    if (!updateHudTexture(render, &values, config)) {
+        drawHud(render, getHudYPosition(), &values, config);
+        return;
+    }
+
+    SDL_Rect dst = {0, getHudYPosition(), WINDOW_WIDTH, HUD_HEIGHT};
+    renderCopy(render->renderer, s_hudTexture, NULL, &dst);
+}
+
+void HUD_shutdown(void) {
+    if (s_hudTexture != NULL) {
+        SDL_DelEventWatch(onRenderReset, NULL);
+        renderDestroyTexture(s_hudTexture);
+    }
+    s_hudTexture = NULL;
+    s_hudRenderer = NULL;
+    s_hudValid = false;
+    s_hudTargetsLost = false;
+}
+
+static void drawProfilerRow(const RenderState* render, int x, int y, const char* label, const ProfileStats* stats) {
+    char buffer[32];
+
+    printTextWithFont(x, y, label, render->font, render->renderer);
+
+    const float values[3] = {stats->minMs, stats->avgMs, stats->p99Ms};
+    for (int i = 0; i < 3; i++) {
+        snprintf(buffer, sizeof(buffer), "%.2f", values[i]);
+        printTextWithFont(x + HUD_DEBUG_VALUES_X + i * HUD_DEBUG_VALUE_WIDTH, y, buffer, render->font, render->renderer);
+    }
+}
+
+static void drawFrameGraph(SDL_Renderer* renderer, int x, int y) {
+    float frames[HUD_DEBUG_GRAPH_WIDTH];
+    const int count = Profiler_getFrameHistory(frames, HUD_DEBUG_GRAPH_WIDTH);
+    const float scale = HUD_DEBUG_GRAPH_HEIGHT / (PROFILER_FRAME_BUDGET_MS * 2.0f);
+
+    SDL_SetRenderDrawColor(renderer, 20, 20, 20, 220);
+    SDL_Rect background = {x, y, HUD_DEBUG_GRAPH_WIDTH, HUD_DEBUG_GRAPH_HEIGHT};
+    renderFillRect(renderer, &background);
+
+    const int bottom = y + HUD_DEBUG_GRAPH_HEIGHT;
+    for (int i = 0; i < count; i++) {
+        int height = (int)(frames[i] * scale);
+        if (height > HUD_DEBUG_GRAPH_HEIGHT) height = HUD_DEBUG_GRAPH_HEIGHT;
+
+        if (frames[i] > PROFILER_FRAME_BUDGET_MS) {
+            SDL_SetRenderDrawColor(renderer, 230, 60, 60, 255);
+        } else {
+            SDL_SetRenderDrawColor(renderer, 80, 200, 80, 255);
+        }
+
+        const int column = x + HUD_DEBUG_GRAPH_WIDTH - count + i;
+        renderDrawLine(renderer, column, bottom, column, bottom - height);
+    }
+
+    const int budgetY = bottom - (int)(PROFILER_FRAME_BUDGET_MS * scale);
+    SDL_SetRenderDrawColor(renderer, 255, 220, 50, 255);
+    renderDrawLine(renderer, x, budgetY, x + HUD_DEBUG_GRAPH_WIDTH - 1, budgetY);
+}
+
+static void drawRenderStatsRow(const RenderState* render, int x, int y, const char* label,
+                               const RenderCounters* counters) {
+    char values[5][16];
+    snprintf(values[0], sizeof(values[0]), "%d", counters->drawCalls);
+    snprintf(values[1], sizeof(values[1]), "%d", counters->textureBinds);
+    snprintf(values[2], sizeof(values[2]), "%d", counters->colorMods);
+    snprintf(values[3], sizeof(values[3]), "%d/%d", counters->texturesCreated, counters->texturesDestroyed);
+    snprintf(values[4], sizeof(values[4]), "%ld", counters->pixelsFilled / 1000);
+
+    printTextWithFont(x, y, label, render->font, render->renderer);
+    for (int i = 0; i < 5; i++) {
+        printTextWithFont(x + HUD_DEBUG_STATS_X + i * HUD_DEBUG_STATS_WIDTH, y, values[i],
+                         render->font, render->renderer);
+    }
+}
+
+static void drawRenderStats(const RenderState* render, int x, int y) {
+    const char* headers[5] = {"draw", "bind", "mod", "tex", "kpx"};
+    printTextWithFont(x, y, "rendu", render->font, render->renderer);
+    for (int i = 0; i < 5; i++) {
+        printTextWithFont(x + HUD_DEBUG_STATS_X + i * HUD_DEBUG_STATS_WIDTH, y, headers[i],
+                         render->font, render->renderer);
+    }
+    y += HUD_DEBUG_LINE_SPACING;
+
+    for (int pass = 0; pass < RENDER_PASS_COUNT; pass++) {
+        drawRenderStatsRow(render, x, y, RenderStats_passName((RenderPass)pass),
+                           RenderStats_getLastFrame((RenderPass)pass));
+        y += HUD_DEBUG_LINE_SPACING;
+    }
+
+    RenderCounters total;
+    RenderStats_getLastFrameTotal(&total);
+    drawRenderStatsRow(render, x, y, "Total", &total);
+}
+
 void HUD_renderDebugInfo(const RenderState* render, int fps, int entityCount) {
     if (!render) return;
 
-    const int hudY = getHudYPosition();
+    const int x = HUD_DEBUG_X + HUD_MARGIN_LEFT;
+    int y = HUD_DEBUG_Y + HUD_MARGIN_TOP;
+    const int rows = PROFILE_ZONE_COUNT + 3 + RENDER_PASS_COUNT + 2;
+
+    SDL_SetRenderDrawBlendMode(render->renderer, SDL_BLENDMODE_BLEND);
+    SDL_SetRenderDrawColor(render->renderer, 0, 0, 0, 180);
+    SDL_Rect panel = {
+        HUD_DEBUG_X, HUD_DEBUG_Y, HUD_DEBUG_WIDTH,
+        rows * HUD_DEBUG_LINE_SPACING + HUD_DEBUG_GRAPH_HEIGHT + 4 * HUD_MARGIN_TOP
+    };
+    renderFillRect(render->renderer, &panel);
+
     char buffer[64];
+    snprintf(buffer, sizeof(buffer), "FPS : %d   Entités : %d", fps, entityCount);
+    printTextWithFont(x, y, buffer, render->font, render->renderer);
+    y += HUD_DEBUG_LINE_SPACING;
+
+    printTextWithFont(x, y, "ms", render->font, render->renderer);
+    const char* headers[3] = {"min", "moy", "p99"};
+    for (int i = 0; i < 3; i++) {
+        printTextWithFont(x + HUD_DEBUG_VALUES_X + i * HUD_DEBUG_VALUE_WIDTH, y, headers[i],
+                         render->font, render->renderer);
+    }
+    y += HUD_DEBUG_LINE_SPACING;
+
+    ProfileStats stats;
+    Profiler_getFrameStats(&stats);
+    drawProfilerRow(render, x, y, "Frame", &stats);
+    y += HUD_DEBUG_LINE_SPACING;
+
+    for (int zone = 0; zone < PROFILE_ZONE_COUNT; zone++) {
+        Profiler_getZoneStats((ProfileZone)zone, &stats);
+        drawProfilerRow(render, x, y, Profiler_zoneName((ProfileZone)zone), &stats);
+        y += HUD_DEBUG_LINE_SPACING;
+    }
+
+    y += HUD_MARGIN_TOP;
+    drawFrameGraph(render->renderer, x, y);
+    y += HUD_DEBUG_GRAPH_HEIGHT + HUD_MARGIN_TOP;
+
+    drawRenderStats(render, x, y);
+}
+
+void HUD_renderLoading(const RenderState* render, int completed, int total) {
+    if (!render || !render->renderer) return;
+    SDL_Renderer* renderer = render->renderer;
+
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
+    clearRenderer(renderer);
 
-    snprintf(buffer, sizeof(buffer), "FPS : %d", fps);
-    printTextWithFont(WINDOW_WIDTH - 100, hudY + HUD_MARGIN_TOP, buffer, render->font, render->renderer);
+    const int barX = (WINDOW_WIDTH - HUD_LOADING_BAR_WIDTH) / 2;
+    const int barY = (WINDOW_HEIGHT - HUD_LOADING_BAR_HEIGHT) / 2;
+    const int filled = total > 0 ? (completed * HUD_LOADING_BAR_WIDTH) / total : HUD_LOADING_BAR_WIDTH;
 
-    snprintf(buffer, sizeof(buffer), "Entités : %d", entityCount);
-    printTextWithFont(WINDOW_WIDTH - 100, hudY + HUD_MARGIN_TOP + HUD_LINE_SPACING,
-                     buffer, render->font, render->renderer);
+    SDL_SetRenderDrawColor(renderer, 100, 150, 255, 255);
+    SDL_Rect fill = {barX, barY, filled, HUD_LOADING_BAR_HEIGHT};
+    renderFillRect(renderer, &fill);
+
+    SDL_SetRenderDrawColor(renderer, 200, 200, 200, 255);
+    SDL_Rect frame = {barX, barY, HUD_LOADING_BAR_WIDTH, HUD_LOADING_BAR_HEIGHT};
+    renderDrawRect(renderer, &frame);
+
+    char buffer[64];
+    snprintf(buffer, sizeof(buffer), "Chargement... %d / %d", completed, total);
+    printTextWithFont(barX, barY - 2 * HUD_MARGIN_TOP - WINDOW_FONT_SIZE, buffer, render->font, renderer);
 }
 
 void HUD_showMessage(const RenderState* render, const char* message, int duration) {
@@ -196,7 +465,7 @@ void HUD_renderHealthBar(const RenderState* render, int x, int y,
 
     SDL_Rect backgroundRect = {x, y, width, height};
     SDL_SetRenderDrawColor(render->renderer, 80, 0, 0, 255);
-    SDL_RenderFillRect(render->renderer, &backgroundRect);
+    renderFillRect(render->renderer, &backgroundRect);
 
     if (filledWidth > 0) {
         SDL_Rect filledRect = {x, y, filledWidth, height};
@@ -212,10 +481,10 @@ void HUD_renderHealthBar(const RenderState* render, int x, int y,
             SDL_SetRenderDrawColor(render->renderer, 200, 0, 0, 255);
         }
 
-        SDL_RenderFillRect(render->renderer, &filledRect);
+        renderFillRect(render->renderer, &filledRect);
     }
 
     SDL_Rect borderRect = {x, y, width, height};
     SDL_SetRenderDrawColor(render->renderer, 255, 255, 255, 255);
-    SDL_RenderDrawRect(render->renderer, &borderRect);
+    renderDrawRect(render->renderer, &borderRect);
 }
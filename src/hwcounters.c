@@ -0,0 +1,253 @@
+#include "hwcounters.h"
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <errno.h>
+#endif
+
+typedef struct {
+    uint64_t values[HW_COUNTER_COUNT];
+    long     calls;
+    long     unscheduled;
+    uint64_t enabledNs;
+    uint64_t runningNs;
+} ZoneCounters;
+
+typedef struct {
+    uint64_t values[HW_COUNTER_COUNT];
+    uint64_t enabledNs;
+    uint64_t runningNs;
+} CounterSample;
+
+static bool          g_active = false;
+static bool          g_available[HW_COUNTER_COUNT];
+static ZoneCounters  g_totals[PROFILE_ZONE_COUNT];
+static CounterSample g_zoneStart[PROFILE_ZONE_COUNT];
+
+#ifdef __linux__
+static const char* COUNTER_NAMES[HW_COUNTER_COUNT] = {
+    [HW_COUNTER_CYCLES]        = "cycles",
+    [HW_COUNTER_INSTRUCTIONS]  = "instructions",
+    [HW_COUNTER_L1D_MISSES]    = "L1d misses",
+    [HW_COUNTER_LLC_MISSES]    = "LLC misses",
+    [HW_COUNTER_BRANCH_MISSES] = "branch misses"
+};
+
+static int g_leader = -1;
+static int g_fds[HW_COUNTER_COUNT];
+static int g_slot[HW_COUNTER_COUNT];
+static int g_slotCount = 0;
+
+static void describeEvent(HwCounter counter, struct perf_event_attr* attr) {
+    memset(attr, 0, sizeof(*attr));
+    attr->size = sizeof(*attr);
+    attr->exclude_kernel = 1;
+    attr->exclude_hv = 1;
+    attr->read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+    switch (counter) {
+        case HW_COUNTER_CYCLES:
+            attr->type = PERF_TYPE_HARDWARE;
+            attr->config = PERF_COUNT_HW_CPU_CYCLES;
+            break;
+        case HW_COUNTER_INSTRUCTIONS:
+            attr->type = PERF_TYPE_HARDWARE;
+            attr->config = PERF_COUNT_HW_INSTRUCTIONS;
+            break;
+        case HW_COUNTER_L1D_MISSES:
+            attr->type = PERF_TYPE_HW_CACHE;
+            attr->config = PERF_COUNT_HW_CACHE_L1D |
+                           (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                           (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+            break;
+        case HW_COUNTER_LLC_MISSES:
+            attr->type = PERF_TYPE_HARDWARE;
+            attr->config = PERF_COUNT_HW_CACHE_MISSES;
+            break;
+        case HW_COUNTER_BRANCH_MISSES:
+            attr->type = PERF_TYPE_HARDWARE;
+            attr->config = PERF_COUNT_HW_BRANCH_MISSES;
+            break;
+        default:
+            break;
+    }
+}
+
+static int openEvent(HwCounter counter, int groupFd) {
+    struct perf_event_attr attr;
+    describeEvent(counter, &attr);
+    attr.disabled = groupFd == -1 ? 1 : 0;
+    return (int)syscall(SYS_perf_event_open, &attr, 0, -1, groupFd, 0);
+}
+
+static bool readCounters(CounterSample* sample) {
+    uint64_t buffer[3 + HW_COUNTER_COUNT];
+    const ssize_t expected = (ssize_t)((3 + g_slotCount) * sizeof(uint64_t));
+    if (read(g_leader, buffer, sizeof(buffer)) < expected) return false;
+
+    sample->enabledNs = buffer[1];
+    sample->runningNs = buffer[2];
+    for (int c = 0; c < HW_COUNTER_COUNT; c++) {
+        sample->values[c] = g_available[c] ? buffer[3 + g_slot[c]] : 0;
+    }
+    return true;
+}
+#endif
+
+bool HwCounters_init(void) {
+    if (g_active) return true;
+    memset(g_totals, 0, sizeof(g_totals));
+    memset(g_available, 0, sizeof(g_available));
+
+#ifdef __linux__
+    g_leader = openEvent(HW_COUNTER_CYCLES, -1);
+    if (g_leader < 0) {
+        fprintf(stderr, "Compteurs materiels indisponibles (%s) : mesure du temps uniquement\n", strerror(errno));
+        return false;
+    }
+
+    g_fds[HW_COUNTER_CYCLES] = g_leader;
+    g_available[HW_COUNTER_CYCLES] = true;
+    g_slot[HW_COUNTER_CYCLES] = 0;
+    g_slotCount = 1;
+
+    for (int c = HW_COUNTER_CYCLES + 1; c < HW_COUNTER_COUNT; c++) {
+        g_fds[c] = openEvent((HwCounter)c, g_leader);
+        if (g_fds[c] < 0) {
+            fprintf(stderr, "Compteur %s indisponible (%s)\n", COUNTER_NAMES[c], strerror(errno));
+            continue;
+        }
+        g_available[c] = true;
+        g_slot[c] = g_slotCount++;
+    }
+
+    ioctl(g_leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(g_leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    g_active = true;
+    return true;
+#else
+    fprintf(stderr, "Compteurs materiels non supportes sur cette plateforme : mesure du temps uniquement\n");
+    return false;
+#endif
+}
+
+void HwCounters_shutdown(void) {
+    if (!g_active) return;
+
+#ifdef __linux__
+    ioctl(g_leader, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+    for (int c = HW_COUNTER_COUNT - 1; c >= 0; c--) {
+        if (g_available[c]) close(g_fds[c]);
+    }
+    g_leader = -1;
+#endif
+    g_active = false;
+}
+
+bool HwCounters_isActive(void) {
+    return g_active;
+}
+
+bool HwCounters_isAvailable(HwCounter counter) {
+    return g_active && g_available[counter];
+}
+
+void HwCounters_zoneBegin(ProfileZone zone) {
+    if (!g_active) return;
+#ifdef __linux__
+    readCounters(&g_zoneStart[zone]);
+#else
+    (void)zone;
+#endif
+}
+
+void HwCounters_zoneEnd(ProfileZone zone) {
+    if (!g_active) return;
+#ifdef __linux__
+    CounterSample now;
+    if (!readCounters(&now)) return;
+
+    const CounterSample* start = &g_zoneStart[zone];
+    ZoneCounters* totals = &g_totals[zone];
+    const uint64_t enabled = now.enabledNs - start->enabledNs;
+    const uint64_t running = now.runningNs - start->runningNs;
+    if (running == 0) {
+        totals->unscheduled++;
+        return;
+    }
+
+    const double scale = (double)enabled / (double)running;
+    for (int c = 0; c < HW_COUNTER_COUNT; c++) {
+        totals->values[c] += (uint64_t)((double)(now.values[c] - start->values[c]) * scale + 0.5);
+    }
+    totals->enabledNs += enabled;
+    totals->runningNs += running;
+    totals->calls++;
+#else
+    (void)zone;
+#endif
+}
+
+void HwCounters_getZoneTotals(ProfileZone zone, uint64_t values[HW_COUNTER_COUNT], long* calls) {
+    memcpy(values, g_totals[zone].values, sizeof(g_totals[zone].values));
+    if (calls) *calls = g_totals[zone].calls;
+}
+
+static double perKiloInstructions(const ZoneCounters* totals, HwCounter counter) {
+    const uint64_t instructions = totals->values[HW_COUNTER_INSTRUCTIONS];
+    if (instructions == 0) return 0.0;
+    return (double)totals->values[counter] * 1000.0 / (double)instructions;
+}
+
+void HwCounters_printReport(FILE* out) {
+    if (!g_active) return;
+
+    long sampled = 0;
+    uint64_t enabledNs = 0;
+    uint64_t runningNs = 0;
+    for (int zone = 0; zone < PROFILE_ZONE_COUNT; zone++) {
+        sampled += g_totals[zone].calls;
+        enabledNs += g_totals[zone].enabledNs;
+        runningNs += g_totals[zone].runningNs;
+    }
+    if (sampled == 0) {
+        fprintf(out, "\nCompteurs materiels jamais planifies par le noyau : mesure du temps uniquement\n");
+        return;
+    }
+
+    fprintf(out, "\n%-12s %10s %12s %6s %10s %10s %10s\n",
+            "zone", "appels", "cycles/app", "IPC", "L1d/kinst", "LLC/kinst", "br/kinst");
+
+    for (int zone = 0; zone < PROFILE_ZONE_COUNT; zone++) {
+        const ZoneCounters* totals = &g_totals[zone];
+        if (totals->calls == 0) continue;
+
+        const char* name = Profiler_zoneName((ProfileZone)zone);
+        while (*name == ' ') name++;
+
+        const double cycles = (double)totals->values[HW_COUNTER_CYCLES];
+        const double ipc = cycles > 0.0 ? (double)totals->values[HW_COUNTER_INSTRUCTIONS] / cycles : 0.0;
+
+        fprintf(out, "%-12s %10ld %12.0f", name, totals->calls, cycles / (double)totals->calls);
+        if (g_available[HW_COUNTER_INSTRUCTIONS]) fprintf(out, " %6.2f", ipc);
+        else fprintf(out, " %6s", "-");
+
+        const HwCounter missCounters[3] = {HW_COUNTER_L1D_MISSES, HW_COUNTER_LLC_MISSES, HW_COUNTER_BRANCH_MISSES};
+        for (int i = 0; i < 3; i++) {
+            if (g_available[missCounters[i]] && g_available[HW_COUNTER_INSTRUCTIONS]) {
+                fprintf(out, " %10.2f", perKiloInstructions(totals, missCounters[i]));
+            } else {
+                fprintf(out, " %10s", "-");
+            }
+        }
+        fputc('\n', out);
+    }
+
+    if (runningNs < enabledNs) {
+        fprintf(out, "Compteurs multiplexes : valeurs extrapolees (actifs %.0f %% du temps)\n",
+                100.0 * (double)runningNs / (double)enabledNs);
+    }
+}
@@ -1,4 +1,5 @@
 #include "iomanager.h"
+#include "render.h"
 
 static InputAction keyToAction(SDL_Keycode key) {
     switch (key) {
@@ -45,6 +46,7 @@ void inputPollContinuous(InputState* state, bool* quit, bool* pause) {
     state->moveRight = false;
     state->attack = false;
     state->interact = false;
+    state->toggleDebug = false;
     *quit = false;
     *pause = false;
 
@@ -58,6 +60,8 @@ void inputPollContinuous(InputState* state, bool* quit, bool* pause) {
         if (event.type == SDL_KEYDOWN && event.key.repeat == 0) {
             if (event.key.keysym.sym == SDLK_ESCAPE || event.key.keysym.sym == SDLK_p) {
                 *pause = true;
+            } else if (event.key.keysym.sym == SDLK_F3) {
+                state->toggleDebug = true;
             }
         }
     }
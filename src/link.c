@@ -1,6 +1,5 @@
 #include "link.h"
 #include "map.h"
-#include "render.h"
 #include "utils.h"
 
 static AnimDirection toAnimDir(LinkDirection dir) {
@@ -21,10 +20,8 @@ void Link_init(Link* link, Map* map) {
     link->attackCooldown = 0;
     link->invincibilityTimer = 0;
     link->isInvincible = false;
-    link->base.texture = NULL;
 
     Animation_init(&link->animation);
-    SpriteSet_loadLink(&link->sprites, map->renderer);
 }
 
 void Link_update(Link* link) {
@@ -77,6 +74,33 @@ void Link_getAttackPosition(const Link* link, int attackPos[2]) {
     }
 }
 
+void Link_getAttackZone(const Link* link, int attackZone[LINK_ATTACK_ZONE_SIZE][2]) {
+    if (!link || !attackZone) return;
+
+    int attackPos[2];
+    Link_getAttackPosition(link, attackPos);
+
+    attackZone[0][0] = attackPos[0];
+    attackZone[0][1] = attackPos[1];
+
+    switch (link->direction) {
+        case LINK_DIR_UP:
+        case LINK_DIR_DOWN:
+            attackZone[1][0] = attackPos[0] - 1;
+            attackZone[1][1] = attackPos[1];
+            attackZone[2][0] = attackPos[0] + 1;
+            attackZone[2][1] = attackPos[1];
+            break;
+        case LINK_DIR_LEFT:
+        case LINK_DIR_RIGHT:
+            attackZone[1][0] = attackPos[0];
+            attackZone[1][1] = attackPos[1] - 1;
+            attackZone[2][0] = attackPos[0];
+            attackZone[2][1] = attackPos[1] + 1;
+            break;
+    }
+}
+
 bool Link_isAttacking(const Link* link) {
     return link && link->isAttacking;
 }
@@ -123,21 +147,3 @@ void Link_moveSmooth(Link* link, float deltaX, float deltaY) {
         Animation_startWalk(&link->animation, animDir);
     }
 }
-
-void Link_draw(const Link* link, SDL_Renderer* renderer) {
-    if (!link || !renderer) return;
-    if (link->isInvincible && (link->invincibilityTimer / 5) % 2 == 0) return;
-
-    SDL_Texture* tex = Animation_getCurrentTexture(&link->animation, &link->sprites);
-    if (!tex) return;
-
-    int screen[2];
-    Camera_worldToScreenF(&link->base.map->camera, link->base.posX, link->base.posY, screen);
-    renderTexture(tex, renderer, screen[0], screen[1], GRID_CELL_SIZE, GRID_CELL_SIZE);
-}
-
-void Link_destroy(Link* link) {
-    if (!link) return;
-    SpriteSet_destroy(&link->sprites);
-    Character_destroy(&link->base);
-}
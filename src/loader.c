@@ -0,0 +1,172 @@
+#include "loader.h"
+#include "trace.h"
+#include "assets.h"
+#include "startupreport.h"
+#include "utils.h"
+
+typedef enum {
+    LOAD_JOB_IMAGE,
+    LOAD_JOB_SOUND
+} LoadJobKind;
+
+typedef struct {
+    char         path[LOADER_PATH_SIZE];
+    LoadJobKind  kind;
+    SDL_Surface* surface;
+    Mix_Chunk*   chunk;
+    SDL_atomic_t done;
+    bool         taken;
+} LoadJob;
+
+typedef struct {
+    LoadJob      jobs[LOADER_MAX_JOBS];
+    int          jobCount;
+    SDL_atomic_t nextJob;
+    SDL_atomic_t completed;
+    SDL_Thread*  workers[LOADER_MAX_WORKERS];
+    int          workerCount;
+    bool         started;
+} Loader;
+
+static Loader g_loader = {0};
+
+static void decodeJob(LoadJob* job) {
+    Trace_beginDetail("decode", "asset", job->path);
+    const uint64_t start = timeNowNs();
+    if (job->kind == LOAD_JOB_IMAGE) {
+        job->surface = SDL_LoadBMP_RW(openAssetRW(job->path), 1);
+    } else {
+        job->chunk = Mix_LoadWAV_RW(openAssetRW(job->path), 1);
+    }
+    if (StartupReport_isEnabled()) {
+        StartupReport_addDecode(job->path, asset_size(job->path), timeNowNs() - start);
+    }
+    Trace_end("decode", "asset");
+}
+
+static int workerMain(void* data) {
+    (void)data;
+
+    for (;;) {
+        const int index = SDL_AtomicAdd(&g_loader.nextJob, 1);
+        if (index >= g_loader.jobCount) return 0;
+
+        LoadJob* job = &g_loader.jobs[index];
+        decodeJob(job);
+        SDL_AtomicSet(&job->done, 1);
+        SDL_AtomicAdd(&g_loader.completed, 1);
+    }
+}
+
+static void queueJob(const char* path, LoadJobKind kind) {
+    if (path == NULL || path[0] == '\0' || g_loader.started) return;
+    if (strlen(path) >= LOADER_PATH_SIZE) return;
+
+    for (int i = 0; i < g_loader.jobCount; i++) {
+        if (g_loader.jobs[i].kind == kind && strcmp(g_loader.jobs[i].path, path) == 0) return;
+    }
+
+    if (g_loader.jobCount >= LOADER_MAX_JOBS) {
+        fprintf(stderr, "Loader plein : %s sera charge a la demande\n", path);
+        return;
+    }
+
+    LoadJob* job = &g_loader.jobs[g_loader.jobCount++];
+    memset(job, 0, sizeof(*job));
+    strcpy(job->path, path);
+    job->kind = kind;
+}
+
+void Loader_queueImage(const char* path) {
+    queueJob(path, LOAD_JOB_IMAGE);
+}
+
+void Loader_queueSound(const char* path) {
+    queueJob(path, LOAD_JOB_SOUND);
+}
+
+void Loader_start(void) {
+    if (g_loader.started) return;
+    g_loader.started = true;
+
+    int workerCount = SDL_GetCPUCount() - 1;
+    if (workerCount < 1) workerCount = 1;
+    if (workerCount > LOADER_MAX_WORKERS) workerCount = LOADER_MAX_WORKERS;
+    if (workerCount > g_loader.jobCount) workerCount = g_loader.jobCount;
+
+    for (int i = 0; i < workerCount; i++) {
+        SDL_Thread* thread = SDL_CreateThread(workerMain, "nuprc-loader", NULL);
+        if (thread == NULL) {
+            fprintf(stderr, "Thread de chargement non cree : %s\n", SDL_GetError());
+            break;
+        }
+        g_loader.workers[g_loader.workerCount++] = thread;
+    }
+
+    if (g_loader.workerCount == 0) {
+        workerMain(NULL);
+    }
+}
+
+void Loader_shutdown(void) {
+    if (!g_loader.started) return;
+
+    SDL_AtomicSet(&g_loader.nextJob, g_loader.jobCount);
+    for (int i = 0; i < g_loader.workerCount; i++) {
+        SDL_WaitThread(g_loader.workers[i], NULL);
+    }
+
+    for (int i = 0; i < g_loader.jobCount; i++) {
+        LoadJob* job = &g_loader.jobs[i];
+        if (job->surface != NULL) SDL_FreeSurface(job->surface);
+        if (job->chunk != NULL) Mix_FreeChunk(job->chunk);
+    }
+
+    memset(&g_loader, 0, sizeof(g_loader));
+}
+
+int Loader_completed(void) {
+    return SDL_AtomicGet(&g_loader.completed);
+}
+
+int Loader_total(void) {
+    return g_loader.jobCount;
+}
+
+bool Loader_isDone(void) {
+    return g_loader.started && Loader_completed() >= g_loader.jobCount;
+}
+
+static LoadJob* takeJob(const char* path, LoadJobKind kind) {
+    if (!g_loader.started || path == NULL) return NULL;
+
+    for (int i = 0; i < g_loader.jobCount; i++) {
+        LoadJob* job = &g_loader.jobs[i];
+        if (job->kind != kind || job->taken || strcmp(job->path, path) != 0) continue;
+
+        while (SDL_AtomicGet(&job->done) == 0) {
+            SDL_Delay(1);
+        }
+        job->taken = true;
+        return job;
+    }
+    return NULL;
+}
+
+SDL_Surface* Loader_takeSurface(const char* path) {
+    LoadJob* job = takeJob(path, LOAD_JOB_IMAGE);
+    if (job == NULL) return NULL;
+
+    SDL_Surface* surface = job->surface;
+    job->surface = NULL;
+    return surface;
+}
+
+Mix_Chunk* Loader_takeChunk(const char* path) {
+    LoadJob* job = takeJob(path, LOAD_JOB_SOUND);
+    if (job == NULL) return NULL;
+
+    Mix_Chunk* chunk = job->chunk;
+    job->chunk = NULL;
+    return chunk;
+}
@@ -1,13 +1,91 @@
 #include "game.h"
+#include "trace.h"
+#include "flightrecorder.h"
+#include "hwcounters.h"
+#include "startupreport.h"
+#include "framebuffer.h"
 
-int main(int argc, char* argv[]) {
-    (void)argc;
-    (void)argv;
+static bool parseOptions(int argc, char* argv[], Game* game, const char** tracePath) {
+    for (int i = 1; i < argc; i++) {
+        const bool hasValue = i + 1 < argc;
+
+        if (strcmp(argv[i], "--record") == 0 && hasValue) {
+            game->replayMode = REPLAY_MODE_RECORD;
+            game->replayPath = argv[++i];
+        } else if (strcmp(argv[i], "--replay") == 0 && hasValue) {
+            game->replayMode = REPLAY_MODE_PLAYBACK;
+            game->replayPath = argv[++i];
+        } else if (strcmp(argv[i], "--trace") == 0 && hasValue) {
+            *tracePath = argv[++i];
+        } else if (strcmp(argv[i], "--hitch-ms") == 0 && hasValue) {
+            FlightRecorder_setThreshold(strtof(argv[++i], NULL));
+        } else if (strcmp(argv[i], "--hitch-report") == 0 && hasValue) {
+            FlightRecorder_setReportPrefix(argv[++i]);
+        } else if (strcmp(argv[i], "--hw-counters") == 0) {
+            HwCounters_init();
+        } else if (strcmp(argv[i], "--startup-report") == 0) {
+            StartupReport_enable();
+        } else if (strcmp(argv[i], "--scale") == 0 && hasValue) {
+            const char* mode = argv[++i];
+            if (strcmp(mode, "integer") == 0) {
+                game->render.scaleMode = RENDER_SCALE_INTEGER;
+            } else if (strcmp(mode, "nearest") == 0) {
+                game->render.scaleMode = RENDER_SCALE_NEAREST;
+            } else {
+                return false;
+            }
+        } else if (strcmp(argv[i], "--renderer") == 0 && hasValue) {
+            const char* backend = argv[++i];
+            if (strcmp(backend, "software") == 0) {
+                game->render.backend = RENDER_BACKEND_SOFTWARE;
+            } else if (strcmp(backend, "gpu") == 0) {
+                game->render.backend = RENDER_BACKEND_GPU;
+            } else {
+                return false;
+            }
+        } else if (strcmp(argv[i], "--simd") == 0 && hasValue) {
+            FramebufferSimd level;
+            if (!Framebuffer_parseSimd(argv[++i], &level)) return false;
+            if (!Framebuffer_setSimd(level)) {
+                fprintf(stderr, "Noyaux %s non supportes par ce processeur\n", Framebuffer_simdName(level));
+                return false;
+            }
+        } else if (strcmp(argv[i], "--frames") == 0 && hasValue) {
+            game->frameLimit = atoi(argv[++i]);
+            if (game->frameLimit <= 0) return false;
+        } else if (strcmp(argv[i], "--screenshot") == 0 && hasValue) {
+            game->screenshotPath = argv[++i];
+        } else {
+            return false;
+        }
+    }
+    return true;
+}
 
+int main(int argc, char* argv[]) {
     Game game = {0};
+    const char* tracePath = NULL;
+    if (!parseOptions(argc, argv, &game, &tracePath)) {
+        fprintf(stderr, "Usage : %s [--record FICHIER | --replay FICHIER] [--trace FICHIER.json]\n"
+                        "       [--hitch-ms SEUIL] [--hitch-report PREFIXE] [--hw-counters]\n"
+                        "       [--startup-report] [--scale nearest|integer]\n"
+                        "       [--renderer gpu|software] [--simd scalar|sse2|avx2]\n"
+                        "       [--frames N] [--screenshot FICHIER.bmp]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    if (tracePath) {
+        Trace_start(tracePath);
+    }
+
     Game_init(&game);
     Game_run(&game);
     Game_destroy(&game);
+    Trace_stop();
+
+    StartupReport_print(stdout);
+    HwCounters_printReport(stdout);
+    HwCounters_shutdown();
 
     return EXIT_SUCCESS;
 }
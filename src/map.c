@@ -1,5 +1,7 @@
 #include "map.h"
-#include "render.h"
+#include "assets.h"
+#include "startupreport.h"
+#include "utils.h"
 
 static float absf(const float value) {
     return value < 0.0f ? -value : value;
@@ -15,6 +17,57 @@ static float clampf(const float value, const float minValue, const float maxValu
     return value;
 }
 
+void loadWorldMap(const char* filePath, int worldMap[GRID_WORLD_HEIGHT][GRID_WORLD_WIDTH]) {
+    const uint64_t start = timeNowNs();
+    AssetData file;
+    if (!asset_load(filePath, &file)) {
+        fprintf(stderr, "Erreur ouverture fichier : %s\n", asset_full(filePath));
+        exit(EXIT_FAILURE);
+    }
+
+    char buffer[1024];
+    size_t cursor = 0;
+    int row = 0;
+
+    while (row < GRID_WORLD_HEIGHT && asset_readLine(&file, &cursor, buffer, sizeof(buffer))) {
+        int col = 0;
+        char* token = strtok(buffer, " \t\r\n");
+
+        while (token != NULL && col < GRID_WORLD_WIDTH) {
+            worldMap[row][col] = (int)strtol(token, NULL, 16);
+            token = strtok(NULL, " \t\r\n");
+            col++;
+        }
+        row++;
+    }
+
+    StartupReport_addDecode(filePath, (long)file.size, timeNowNs() - start);
+    asset_release(&file);
+}
+
+void loadBlockingMap(const char* filePath, char blockingMap[GRID_WORLD_HEIGHT][GRID_WORLD_WIDTH]) {
+    const uint64_t start = timeNowNs();
+    AssetData file;
+    if (!asset_load(filePath, &file)) {
+        fprintf(stderr, "Erreur ouverture fichier : %s\n", asset_full(filePath));
+        exit(EXIT_FAILURE);
+    }
+
+    char buffer[512];
+    size_t cursor = 0;
+    int row = 0;
+
+    while (row < GRID_WORLD_HEIGHT && asset_readLine(&file, &cursor, buffer, sizeof(buffer))) {
+        for (int col = 0; col < GRID_WORLD_WIDTH && buffer[col] != '\0' && buffer[col] != '\n'; col++) {
+            blockingMap[row][col] = buffer[col];
+        }
+        row++;
+    }
+
+    StartupReport_addDecode(filePath, (long)file.size, timeNowNs() - start);
+    asset_release(&file);
+}
+
 static Tile createTile(const char blockingChar, const int textureId) {
     Tile tile;
     tile.isBlocking = (blockingChar == 'X');
@@ -22,7 +75,73 @@ static Tile createTile(const char blockingChar, const int textureId) {
     return tile;
 }
 
+static uint16_t readU16(const unsigned char* in) {
+    return (uint16_t)(in[0] | (in[1] << 8));
+}
+
+static uint32_t readU32(const unsigned char* in) {
+    return (uint32_t)in[0] | ((uint32_t)in[1] << 8) |
+           ((uint32_t)in[2] << 16) | ((uint32_t)in[3] << 24);
+}
+
+static bool loadBinaryMap(Map* map, const char* filePath) {
+    const uint64_t start = timeNowNs();
+    AssetData file;
+    if (!asset_load(filePath, &file)) return false;
+
+    const size_t cellCount = (size_t)GRID_WORLD_WIDTH * GRID_WORLD_HEIGHT;
+    const unsigned char* tiles = NULL;
+    const unsigned char* blocking = NULL;
+
+    bool valid = file.size >= MAP_FILE_HEADER_SIZE &&
+                 memcmp(file.data, MAP_FILE_MAGIC, 4) == 0 &&
+                 readU16(file.data + 4) == MAP_FILE_VERSION &&
+                 readU16(file.data + 8) == GRID_WORLD_WIDTH &&
+                 readU16(file.data + 10) == GRID_WORLD_HEIGHT;
+
+    const int sectionCount = valid ? readU16(file.data + 6) : 0;
+    size_t cursor = MAP_FILE_HEADER_SIZE;
+
+    for (int s = 0; valid && s < sectionCount; s++) {
+        if (cursor > file.size || file.size - cursor < MAP_SECTION_HEADER_SIZE) {
+            valid = false;
+            break;
+        }
+
+        const unsigned char* section = file.data + cursor;
+        const size_t size = readU32(section + 4);
+        cursor += MAP_SECTION_HEADER_SIZE;
+        if (size > file.size - cursor) {
+            valid = false;
+            break;
+        }
+
+        if (memcmp(section, MAP_SECTION_TILES, 4) == 0 && size == cellCount) {
+            tiles = file.data + cursor;
+        } else if (memcmp(section, MAP_SECTION_BLOCKING, 4) == 0 && size == (cellCount + 7) / 8) {
+            blocking = file.data + cursor;
+        }
+        cursor += (size + 3) & ~(size_t)3;
+    }
+
+    valid = valid && tiles && blocking;
+    if (valid) {
+        for (size_t i = 0; i < cellCount; i++) {
+            const bool isBlocking = (blocking[i / 8] >> (i % 8)) & 1u;
+            map->world[i / GRID_WORLD_WIDTH][i % GRID_WORLD_WIDTH] = createTile(isBlocking ? 'X' : ' ', tiles[i]);
+        }
+    } else {
+        fprintf(stderr, "Carte binaire invalide, retour aux fichiers texte : %s\n", asset_full(filePath));
+    }
+
+    StartupReport_addDecode(filePath, (long)file.size, timeNowNs() - start);
+    asset_release(&file);
+    return valid;
+}
+
 static void loadMapData(Map* map) {
+    if (loadBinaryMap(map, ASSET_MAP_BINARY)) return;
+
     char blocking[GRID_WORLD_HEIGHT][GRID_WORLD_WIDTH];
     int overworld[GRID_WORLD_HEIGHT][GRID_WORLD_WIDTH];
 
@@ -45,31 +164,13 @@ static Room createRoom(const int roomX, const int roomY) {
     return room;
 }
 
-static void drawGrid(SDL_Renderer* renderer) {
-    SDL_SetRenderDrawColor(renderer, 255, 255, 255, 80);
-
-    int gameHeight = WINDOW_HEIGHT - WINDOW_TEXTAREA_HEIGHT;
-
-    for (int row = 1; row < gameHeight / GRID_CELL_SIZE; row++) {
-        SDL_RenderDrawLine(renderer,
-            0, row * GRID_CELL_SIZE,
-            WINDOW_WIDTH - 1, row * GRID_CELL_SIZE
-        );
-    }
-
-    for (int col = 1; col < WINDOW_WIDTH / GRID_CELL_SIZE; col++) {
-        SDL_RenderDrawLine(renderer,
-            col * GRID_CELL_SIZE, 0,
-            col * GRID_CELL_SIZE, gameHeight - 1
-        );
-    }
-}
-
 void Camera_init(Camera* cam) {
     cam->x = 0.0f;
     cam->y = 0.0f;
     cam->targetX = 0.0f;
     cam->targetY = 0.0f;
+    cam->prevX = 0.0f;
+    cam->prevY = 0.0f;
 }
 
 void Camera_followF(Camera* cam, float playerX, float playerY) {
@@ -100,6 +201,17 @@ void Camera_follow(Camera* cam, const int playerPos[2]) {
     Camera_followF(cam, (float)playerPos[0], (float)playerPos[1]);
 }
 
+void Camera_savePosition(Camera* cam) {
+    cam->prevX = cam->x;
+    cam->prevY = cam->y;
+}
+
+void Camera_interpolate(const Camera* cam, float alpha, Camera* out) {
+    *out = *cam;
+    out->x = cam->prevX + (cam->x - cam->prevX) * alpha;
+    out->y = cam->prevY + (cam->y - cam->prevY) * alpha;
+}
+
 void Camera_worldToScreenF(const Camera* cam, float worldX, float worldY, int screenPos[2]) {
     screenPos[0] = roundToInt(worldX * GRID_CELL_SIZE - cam->x);
     screenPos[1] = roundToInt(worldY * GRID_CELL_SIZE - cam->y);
@@ -109,17 +221,9 @@ void Camera_worldToScreen(const Camera* cam, const int worldPos[2], int screenPo
     Camera_worldToScreenF(cam, (float)worldPos[0], (float)worldPos[1], screenPos);
 }
 
-void Map_init(Map* map, SDL_Renderer* renderer) {
-    map->renderer = renderer;
-
+void Map_init(Map* map) {
     loadMapData(map);
 
-    map->textures = loadTileTextures(ASSET_MAP_TILES, renderer);
-    if (map->textures == NULL) {
-        fprintf(stderr, "Erreur: impossible de charger les textures de la carte\n");
-        exit(EXIT_FAILURE);
-    }
-
     const int maxRoomX = GRID_WORLD_WIDTH / GRID_ROOM_WIDTH;
     const int maxRoomY = GRID_WORLD_HEIGHT / GRID_ROOM_HEIGHT;
 
@@ -135,62 +239,6 @@ void Map_init(Map* map, SDL_Renderer* renderer) {
     Camera_init(&map->camera);
 }
 
-void Map_draw(const Map* map, bool showGrid) {
-    int gameHeight = WINDOW_HEIGHT - WINDOW_TEXTAREA_HEIGHT;
-
-    int startTileX = (int)(map->camera.x / GRID_CELL_SIZE);
-    int startTileY = (int)(map->camera.y / GRID_CELL_SIZE);
-    int endTileX = (int)((map->camera.x + WINDOW_WIDTH) / GRID_CELL_SIZE) + 2;
-    int endTileY = (int)((map->camera.y + gameHeight) / GRID_CELL_SIZE) + 2;
-
-    if (startTileX < 0) startTileX = 0;
-    if (startTileY < 0) startTileY = 0;
-    if (endTileX > GRID_WORLD_WIDTH) endTileX = GRID_WORLD_WIDTH;
-    if (endTileY > GRID_WORLD_HEIGHT) endTileY = GRID_WORLD_HEIGHT;
-
-    for (int row = startTileY; row < endTileY; row++) {
-        for (int col = startTileX; col < endTileX; col++) {
-            const Tile tile = map->world[row][col];
-            const int tileIndex = (int)tile.textureId;
-
-            int screenX = roundToInt(col * GRID_CELL_SIZE - map->camera.x);
-            int screenY = roundToInt(row * GRID_CELL_SIZE - map->camera.y);
-
-            if (tileIndex >= 0 && tileIndex < MAP_TILES_COUNT && map->textures[tileIndex] != NULL) {
-                renderTexture(
-                    map->textures[tileIndex], map->renderer,
-                    screenX, screenY,
-                    GRID_CELL_SIZE, GRID_CELL_SIZE
-                );
-            } else {
-
-                SDL_SetRenderDrawColor(map->renderer, 255, 0, 255, 255);
-                SDL_Rect rect = {screenX, screenY, GRID_CELL_SIZE, GRID_CELL_SIZE};
-                SDL_RenderFillRect(map->renderer, &rect);
-            }
-        }
-    }
-
-    if (showGrid) {
-        drawGrid(map->renderer);
-    }
-}
-
-void Map_destroy(Map* map) {
-    if (map->textures == NULL) {
-        return;
-    }
-
-    for (int i = 0; i < MAP_TILES_COUNT; i++) {
-        if (map->textures[i] != NULL) {
-            SDL_DestroyTexture(map->textures[i]);
-        }
-    }
-
-    free(map->textures);
-    map->textures = NULL;
-}
-
 bool Map_isBlocking(const Map* map, const int pos[2]) {
     if (pos[0] < 0 || pos[0] >= GRID_WORLD_WIDTH ||
         pos[1] < 0 || pos[1] >= GRID_WORLD_HEIGHT) {
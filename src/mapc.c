@@ -0,0 +1,91 @@
+#include "map.h"
+
+#define MAP_CELL_COUNT  (GRID_WORLD_WIDTH * GRID_WORLD_HEIGHT)
+#define MAP_BITSET_SIZE ((MAP_CELL_COUNT + 7) / 8)
+
+static int           g_tileIds[GRID_WORLD_HEIGHT][GRID_WORLD_WIDTH];
+static char          g_blocking[GRID_WORLD_HEIGHT][GRID_WORLD_WIDTH];
+static unsigned char g_tiles[MAP_CELL_COUNT];
+static unsigned char g_blockingBits[MAP_BITSET_SIZE];
+
+static void usage(const char* program) {
+    fprintf(stderr, "Usage : %s TUILES.txt BLOCAGE.txt SORTIE.nmap\n", program);
+    fprintf(stderr, "  Compile les cartes texte (ids hexadecimaux, 'X' = bloquant) en carte binaire\n");
+}
+
+static void writeU16(unsigned char* out, uint16_t value) {
+    out[0] = (unsigned char)(value & 0xFFu);
+    out[1] = (unsigned char)(value >> 8);
+}
+
+static void writeU32(unsigned char* out, uint32_t value) {
+    for (int i = 0; i < 4; i++) {
+        out[i] = (unsigned char)((value >> (i * 8)) & 0xFFu);
+    }
+}
+
+static bool writeSection(FILE* out, const char* tag, const unsigned char* data, uint32_t size) {
+    static const unsigned char padding[4] = {0};
+    unsigned char header[MAP_SECTION_HEADER_SIZE];
+    memcpy(header, tag, 4);
+    writeU32(header + 4, size);
+
+    const size_t padded = ((size_t)size + 3) & ~(size_t)3;
+    return fwrite(header, 1, sizeof(header), out) == sizeof(header) &&
+           fwrite(data, 1, size, out) == size &&
+           fwrite(padding, 1, padded - size, out) == padded - size;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc != 4) {
+        usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    loadWorldMap(argv[1], g_tileIds);
+    loadBlockingMap(argv[2], g_blocking);
+
+    for (int i = 0; i < MAP_CELL_COUNT; i++) {
+        const int row = i / GRID_WORLD_WIDTH;
+        const int col = i % GRID_WORLD_WIDTH;
+
+        if (g_tileIds[row][col] < 0 || g_tileIds[row][col] > 0xFF) {
+            fprintf(stderr, "Tuile hors limites (%d,%d) : %d\n", row, col, g_tileIds[row][col]);
+            return EXIT_FAILURE;
+        }
+
+        g_tiles[i] = (unsigned char)g_tileIds[row][col];
+        if (g_blocking[row][col] == 'X') {
+            g_blockingBits[i / 8] |= (unsigned char)(1u << (i % 8));
+        }
+    }
+
+    unsigned char header[MAP_FILE_HEADER_SIZE] = {0};
+    memcpy(header, MAP_FILE_MAGIC, 4);
+    writeU16(header + 4, MAP_FILE_VERSION);
+    writeU16(header + 6, 2);
+    writeU16(header + 8, GRID_WORLD_WIDTH);
+    writeU16(header + 10, GRID_WORLD_HEIGHT);
+    writeU16(header + 12, GRID_ROOM_WIDTH);
+    writeU16(header + 14, GRID_ROOM_HEIGHT);
+
+    FILE* out = fopen(argv[3], "wb");
+    if (!out) {
+        fprintf(stderr, "Impossible d'ecrire %s\n", argv[3]);
+        return EXIT_FAILURE;
+    }
+
+    bool ok = fwrite(header, 1, sizeof(header), out) == sizeof(header) &&
+              writeSection(out, MAP_SECTION_TILES, g_tiles, MAP_CELL_COUNT) &&
+              writeSection(out, MAP_SECTION_BLOCKING, g_blockingBits, MAP_BITSET_SIZE);
+    if (fclose(out) != 0) ok = false;
+
+    if (!ok) {
+        fprintf(stderr, "Ecriture incomplete de %s\n", argv[3]);
+        remove(argv[3]);
+        return EXIT_FAILURE;
+    }
+
+    printf("%s : %dx%d tuiles\n", argv[3], GRID_WORLD_WIDTH, GRID_WORLD_HEIGHT);
+    return EXIT_SUCCESS;
+}
@@ -2,6 +2,7 @@
 #include "render.h"
 #include "iomanager.h"
 #include "audio.h"
+#include "text.h"
 #include <string.h>
 
 static void addOption(Menu* menu, const char* label, MenuAction action, bool enabled) {
@@ -21,56 +22,47 @@ static void drawStyledRect(SDL_Renderer* renderer, int x, int y, int w, int h,
     if (selected) {
         SDL_SetRenderDrawColor(renderer, borderColor.r, borderColor.g, borderColor.b, borderColor.a);
         SDL_Rect border = {x - 2, y - 2, w + 4, h + 4};
-        SDL_RenderFillRect(renderer, &border);
+        renderFillRect(renderer, &border);
     }
 
     SDL_SetRenderDrawColor(renderer, fillColor.r, fillColor.g, fillColor.b, fillColor.a);
     SDL_Rect rect = {x, y, w, h};
-    SDL_RenderFillRect(renderer, &rect);
+    renderFillRect(renderer, &rect);
 
     if (selected) {
         SDL_SetRenderDrawColor(renderer, 255, 255, 255, 60);
-        SDL_RenderDrawLine(renderer, x + 2, y + 2, x + w - 2, y + 2);
+        renderDrawLine(renderer, x + 2, y + 2, x + w - 2, y + 2);
     }
 }
 
 static void drawTitle(SDL_Renderer* renderer, TTF_Font* font, const char* title, int centerX, int y) {
     if (!font || !title) return;
 
+    int width;
+    Text_size(font, title, &width, NULL);
+
     SDL_Color shadowColor = {0, 0, 0, 200};
-    SDL_Surface* shadowSurface = TTF_RenderText_Solid(font, title, shadowColor);
-    if (shadowSurface) {
-        SDL_Texture* shadowTex = SDL_CreateTextureFromSurface(renderer, shadowSurface);
-        if (shadowTex) {
-            SDL_Rect shadowRect = {centerX - shadowSurface->w / 2 + 3, y + 3,
-                                   shadowSurface->w, shadowSurface->h};
-            SDL_RenderCopy(renderer, shadowTex, NULL, &shadowRect);
-            SDL_DestroyTexture(shadowTex);
-        }
-        SDL_FreeSurface(shadowSurface);
-    }
+    Text_draw(renderer, font, centerX - width / 2 + 3, y + 3, title, shadowColor);
 
     SDL_Color titleColor = {MENU_TEXT_R, MENU_TEXT_G, MENU_TEXT_B, MENU_TEXT_A};
-    SDL_Surface* surface = TTF_RenderText_Solid(font, title, titleColor);
-    if (surface) {
-        SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
-        if (texture) {
-            SDL_Rect rect = {centerX - surface->w / 2, y, surface->w, surface->h};
-            SDL_RenderCopy(renderer, texture, NULL, &rect);
-            SDL_DestroyTexture(texture);
-        }
-        SDL_FreeSurface(surface);
-    }
+    Text_draw(renderer, font, centerX - width / 2, y, title, titleColor);
+}
+
+static void drawCenteredText(SDL_Renderer* renderer, TTF_Font* font, const char* text,
+                             int centerX, int y, SDL_Color color) {
+    int width;
+    Text_size(font, text, &width, NULL);
+    Text_draw(renderer, font, centerX - width / 2, y, text, color);
 }
 
 static void drawMenuBackground(SDL_Renderer* renderer, MenuType type) {
 
     SDL_SetRenderDrawColor(renderer, MENU_BG_R, MENU_BG_G, MENU_BG_B, MENU_BG_A);
-    SDL_RenderClear(renderer);
+    clearRenderer(renderer);
 
     SDL_SetRenderDrawColor(renderer, 40, 40, 50, 255);
     for (int i = 0; i < WINDOW_HEIGHT; i += 4) {
-        SDL_RenderDrawLine(renderer, 0, i, WINDOW_WIDTH, i);
+        renderDrawLine(renderer, 0, i, WINDOW_WIDTH, i);
     }
 
     SDL_Color borderColor = {100, 150, 255, 255};
@@ -91,17 +83,17 @@ static void drawMenuBackground(SDL_Renderer* renderer, MenuType type) {
 
     SDL_SetRenderDrawColor(renderer, borderColor.r, borderColor.g, borderColor.b, borderColor.a);
 
-    SDL_RenderDrawLine(renderer, 50, 50, WINDOW_WIDTH - 50, 50);
-    SDL_RenderDrawLine(renderer, 50, WINDOW_HEIGHT - 50, WINDOW_WIDTH - 50, WINDOW_HEIGHT - 50);
+    renderDrawLine(renderer, 50, 50, WINDOW_WIDTH - 50, 50);
+    renderDrawLine(renderer, 50, WINDOW_HEIGHT - 50, WINDOW_WIDTH - 50, WINDOW_HEIGHT - 50);
 
     SDL_Rect cornerTL = {45, 45, 10, 10};
     SDL_Rect cornerTR = {WINDOW_WIDTH - 55, 45, 10, 10};
     SDL_Rect cornerBL = {45, WINDOW_HEIGHT - 55, 10, 10};
     SDL_Rect cornerBR = {WINDOW_WIDTH - 55, WINDOW_HEIGHT - 55, 10, 10};
-    SDL_RenderFillRect(renderer, &cornerTL);
-    SDL_RenderFillRect(renderer, &cornerTR);
-    SDL_RenderFillRect(renderer, &cornerBL);
-    SDL_RenderFillRect(renderer, &cornerBR);
+    renderFillRect(renderer, &cornerTL);
+    renderFillRect(renderer, &cornerTR);
+    renderFillRect(renderer, &cornerBL);
+    renderFillRect(renderer, &cornerBR);
 }
 
 void Menu_initMain(Menu* menu) {
@@ -224,17 +216,8 @@ void Menu_render(const Menu* menu, const RenderState* render) {
 
     if (strlen(menu->subtitle) > 0 && render->font) {
         SDL_Color subtitleColor = {180, 180, 180, 255};
-        SDL_Surface* surface = TTF_RenderText_Solid(render->font, menu->subtitle, subtitleColor);
-        if (surface) {
-            SDL_Texture* texture = SDL_CreateTextureFromSurface(render->renderer, surface);
-            if (texture) {
-                SDL_Rect rect = {WINDOW_WIDTH / 2 - surface->w / 2, titleY + 35,
-                                surface->w, surface->h};
-                SDL_RenderCopy(render->renderer, texture, NULL, &rect);
-                SDL_DestroyTexture(texture);
-            }
-            SDL_FreeSurface(surface);
-        }
+        drawCenteredText(render->renderer, render->font, menu->subtitle, WINDOW_WIDTH / 2, titleY + 35,
+                         subtitleColor);
     }
 
     int menuStartY = WINDOW_HEIGHT / 2 - (menu->optionCount * (MENU_BUTTON_HEIGHT + MENU_BUTTON_SPACING)) / 2;
@@ -265,20 +248,11 @@ void Menu_render(const Menu* menu, const RenderState* render) {
                        fillColor, borderColor, isSelected);
 
         if (render->font) {
-            SDL_Surface* surface = TTF_RenderText_Solid(render->font, opt->label, textColor);
-            if (surface) {
-                SDL_Texture* texture = SDL_CreateTextureFromSurface(render->renderer, surface);
-                if (texture) {
-                    SDL_Rect textRect = {
-                        buttonX + MENU_BUTTON_WIDTH / 2 - surface->w / 2,
-                        buttonY + MENU_BUTTON_HEIGHT / 2 - surface->h / 2,
-                        surface->w, surface->h
-                    };
-                    SDL_RenderCopy(render->renderer, texture, NULL, &textRect);
-                    SDL_DestroyTexture(texture);
-                }
-                SDL_FreeSurface(surface);
-            }
+            int textHeight;
+            Text_size(render->font, opt->label, NULL, &textHeight);
+            drawCenteredText(render->renderer, render->font, opt->label,
+                             buttonX + MENU_BUTTON_WIDTH / 2, buttonY + MENU_BUTTON_HEIGHT / 2 - textHeight / 2,
+                             textColor);
         }
 
         if (isSelected) {
@@ -287,7 +261,7 @@ void Menu_render(const Menu* menu, const RenderState* render) {
             int arrowY = buttonY + MENU_BUTTON_HEIGHT / 2;
 
             for (int j = 0; j < 8; j++) {
-                SDL_RenderDrawLine(render->renderer, arrowX, arrowY - j, arrowX, arrowY + j);
+                renderDrawLine(render->renderer, arrowX, arrowY - j, arrowX, arrowY + j);
                 arrowX++;
             }
         }
@@ -296,18 +270,9 @@ void Menu_render(const Menu* menu, const RenderState* render) {
     if (render->font) {
         const char* instructions = "[Haut/Bas] Naviguer   [Entree/Espace] Valider";
         SDL_Color instrColor = {120, 120, 120, 255};
-        SDL_Surface* surface = TTF_RenderText_Solid(render->font, instructions, instrColor);
-        if (surface) {
-            SDL_Texture* texture = SDL_CreateTextureFromSurface(render->renderer, surface);
-            if (texture) {
-                SDL_Rect rect = {WINDOW_WIDTH / 2 - surface->w / 2, WINDOW_HEIGHT - 70,
-                                surface->w, surface->h};
-                SDL_RenderCopy(render->renderer, texture, NULL, &rect);
-                SDL_DestroyTexture(texture);
-            }
-            SDL_FreeSurface(surface);
-        }
+        drawCenteredText(render->renderer, render->font, instructions, WINDOW_WIDTH / 2, WINDOW_HEIGHT - 70,
+                         instrColor);
     }
 
-    SDL_RenderPresent(render->renderer);
+    updateDisplay(render);
 }
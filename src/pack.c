@@ -0,0 +1,206 @@
+#include "assets.h"
+
+typedef struct {
+    char        path[ASSET_PACK_PATH_SIZE];
+    const char* source;
+    uint64_t    offset;
+    uint64_t    size;
+    uint32_t    checksum;
+} PackEntry;
+
+static void usage(const char* program) {
+    fprintf(stderr, "Usage : %s SORTIE.pak RACINE FICHIER...\n", program);
+    fprintf(stderr, "       %s --verify ARCHIVE.pak\n", program);
+    fprintf(stderr, "  Les FICHIERS sont relatifs a RACINE et deviennent les chemins de l'index\n");
+    fprintf(stderr, "  CHEMIN=SOURCE ajoute un fichier genere hors de RACINE sous le nom CHEMIN\n");
+}
+
+static void writeU32(unsigned char* out, uint32_t value) {
+    for (int i = 0; i < 4; i++) {
+        out[i] = (unsigned char)((value >> (i * 8)) & 0xFFu);
+    }
+}
+
+static void writeU64(unsigned char* out, uint64_t value) {
+    writeU32(out, (uint32_t)(value & 0xFFFFFFFFu));
+    writeU32(out + 4, (uint32_t)(value >> 32));
+}
+
+static uint32_t readU32(const unsigned char* in) {
+    return (uint32_t)in[0] | ((uint32_t)in[1] << 8) |
+           ((uint32_t)in[2] << 16) | ((uint32_t)in[3] << 24);
+}
+
+static uint64_t readU64(const unsigned char* in) {
+    return (uint64_t)readU32(in) | ((uint64_t)readU32(in + 4) << 32);
+}
+
+static int compareEntries(const void* a, const void* b) {
+    return strcmp(((const PackEntry*)a)->path, ((const PackEntry*)b)->path);
+}
+
+static unsigned char* readFile(const char* path, size_t* size) {
+    FILE* file = fopen(path, "rb");
+    if (!file) return NULL;
+
+    bool ok = fseek(file, 0, SEEK_END) == 0;
+    const long length = ok ? ftell(file) : -1;
+    ok = length >= 0 && fseek(file, 0, SEEK_SET) == 0;
+
+    unsigned char* data = ok ? malloc(length > 0 ? (size_t)length : 1) : NULL;
+    ok = data && fread(data, 1, (size_t)length, file) == (size_t)length;
+    fclose(file);
+
+    if (!ok) {
+        free(data);
+        return NULL;
+    }
+
+    *size = (size_t)length;
+    return data;
+}
+
+static bool writeIndex(FILE* out, const PackEntry* entries, uint32_t count) {
+    unsigned char header[ASSET_PACK_HEADER_SIZE] = {0};
+    memcpy(header, ASSET_PACK_MAGIC, 4);
+    writeU32(header + 4, ASSET_PACK_VERSION);
+    writeU32(header + 8, count);
+
+    bool ok = fseek(out, 0, SEEK_SET) == 0 &&
+              fwrite(header, 1, sizeof(header), out) == sizeof(header);
+
+    for (uint32_t i = 0; ok && i < count; i++) {
+        unsigned char entry[ASSET_PACK_ENTRY_SIZE] = {0};
+        memcpy(entry, entries[i].path, ASSET_PACK_PATH_SIZE);
+        writeU64(entry + ASSET_PACK_PATH_SIZE, entries[i].offset);
+        writeU64(entry + ASSET_PACK_PATH_SIZE + 8, entries[i].size);
+        writeU32(entry + ASSET_PACK_PATH_SIZE + 16, entries[i].checksum);
+        ok = fwrite(entry, 1, sizeof(entry), out) == sizeof(entry);
+    }
+
+    return ok;
+}
+
+static int packAssets(const char* outputPath, const char* root, int fileCount, char* files[]) {
+    PackEntry* entries = calloc(fileCount > 0 ? (size_t)fileCount : 1, sizeof(PackEntry));
+    if (!entries) return EXIT_FAILURE;
+
+    for (int i = 0; i < fileCount; i++) {
+        const char* separator = strchr(files[i], '=');
+        const size_t length = separator ? (size_t)(separator - files[i]) : strlen(files[i]);
+        if (length >= ASSET_PACK_PATH_SIZE) {
+            fprintf(stderr, "Chemin trop long pour l'archive : %s\n", files[i]);
+            free(entries);
+            return EXIT_FAILURE;
+        }
+
+        snprintf(entries[i].path, sizeof(entries[i].path), "%.*s", (int)length, files[i]);
+        entries[i].source = separator ? separator + 1 : NULL;
+        for (char* c = entries[i].path; *c != '\0'; c++) {
+            if (*c == '\\') *c = '/';
+        }
+    }
+    qsort(entries, (size_t)fileCount, sizeof(PackEntry), compareEntries);
+
+    FILE* out = fopen(outputPath, "wb");
+    if (!out) {
+        fprintf(stderr, "Impossible d'ecrire %s\n", outputPath);
+        free(entries);
+        return EXIT_FAILURE;
+    }
+
+    uint64_t offset = ASSET_PACK_HEADER_SIZE + (uint64_t)fileCount * ASSET_PACK_ENTRY_SIZE;
+    bool ok = writeIndex(out, entries, (uint32_t)fileCount);
+
+    for (int i = 0; ok && i < fileCount; i++) {
+        const uint64_t aligned = (offset + ASSET_PACK_ALIGNMENT - 1) & ~(uint64_t)(ASSET_PACK_ALIGNMENT - 1);
+        static const unsigned char padding[ASSET_PACK_ALIGNMENT] = {0};
+        ok = fwrite(padding, 1, (size_t)(aligned - offset), out) == (size_t)(aligned - offset);
+
+        char sourcePath[1024];
+        if (entries[i].source) {
+            snprintf(sourcePath, sizeof(sourcePath), "%s", entries[i].source);
+        } else {
+            snprintf(sourcePath, sizeof(sourcePath), "%s/%s", root, entries[i].path);
+        }
+
+        size_t size = 0;
+        unsigned char* data = ok ? readFile(sourcePath, &size) : NULL;
+        if (ok && !data) {
+            fprintf(stderr, "Asset illisible : %s\n", sourcePath);
+            ok = false;
+        }
+
+        if (ok) {
+            entries[i].offset = aligned;
+            entries[i].size = size;
+            entries[i].checksum = asset_checksum(data, size);
+            ok = fwrite(data, 1, size, out) == size;
+            offset = aligned + size;
+        }
+        free(data);
+    }
+
+    ok = ok && writeIndex(out, entries, (uint32_t)fileCount);
+    if (fclose(out) != 0) ok = false;
+    free(entries);
+
+    if (!ok) {
+        fprintf(stderr, "Ecriture incomplete de %s\n", outputPath);
+        remove(outputPath);
+        return EXIT_FAILURE;
+    }
+
+    printf("%s : %d assets, %llu octets\n", outputPath, fileCount, (unsigned long long)offset);
+    return EXIT_SUCCESS;
+}
+
+static int verifyArchive(const char* archivePath) {
+    size_t size = 0;
+    unsigned char* archive = readFile(archivePath, &size);
+    if (!archive || size < ASSET_PACK_HEADER_SIZE || memcmp(archive, ASSET_PACK_MAGIC, 4) != 0 ||
+        readU32(archive + 4) != ASSET_PACK_VERSION) {
+        fprintf(stderr, "Archive invalide : %s\n", archivePath);
+        free(archive);
+        return EXIT_FAILURE;
+    }
+
+    const uint32_t count = readU32(archive + 8);
+    if (ASSET_PACK_HEADER_SIZE + (uint64_t)count * ASSET_PACK_ENTRY_SIZE > size) {
+        fprintf(stderr, "Index tronque : %s\n", archivePath);
+        free(archive);
+        return EXIT_FAILURE;
+    }
+
+    int failures = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        const unsigned char* entry = archive + ASSET_PACK_HEADER_SIZE + (size_t)i * ASSET_PACK_ENTRY_SIZE;
+        const uint64_t offset = readU64(entry + ASSET_PACK_PATH_SIZE);
+        const uint64_t length = readU64(entry + ASSET_PACK_PATH_SIZE + 8);
+        const uint32_t checksum = readU32(entry + ASSET_PACK_PATH_SIZE + 16);
+
+        const bool inside = offset <= size && length <= size - offset;
+        const bool valid = inside && asset_checksum(archive + offset, (size_t)length) == checksum;
+        if (!valid) failures++;
+
+        printf("%10llu  %08x  %-8s %.*s\n", (unsigned long long)length, checksum,
+               valid ? "ok" : "CORROMPU", ASSET_PACK_PATH_SIZE, (const char*)entry);
+    }
+
+    free(archive);
+    printf("%u assets, %d corrompu(s)\n", count, failures);
+    return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc == 3 && strcmp(argv[1], "--verify") == 0) {
+        return verifyArchive(argv[2]);
+    }
+
+    if (argc < 3 || argv[1][0] == '-') {
+        usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    return packAssets(argv[1], argv[2], argc - 3, argv + 3);
+}
@@ -0,0 +1,140 @@
+#include "profiler.h"
+#include "utils.h"
+#include "trace.h"
+#include "flightrecorder.h"
+#include "hwcounters.h"
+
+typedef struct {
+    float zoneMs[PROFILE_ZONE_COUNT];
+    float frameMs;
+} ProfileFrame;
+
+static const char* ZONE_NAMES[PROFILE_ZONE_COUNT] = {
+    [PROFILE_ZONE_INPUT]     = "Entrees",
+    [PROFILE_ZONE_UPDATE]    = "Update",
+    [PROFILE_ZONE_AI]        = "  IA",
+    [PROFILE_ZONE_COLLISION] = "  Collisions",
+    [PROFILE_ZONE_SPAWN]     = "  Spawn",
+    [PROFILE_ZONE_MAP]       = "Carte",
+    [PROFILE_ZONE_ENTITIES]  = "Entites",
+    [PROFILE_ZONE_HUD]       = "HUD",
+    [PROFILE_ZONE_PRESENT]   = "Present"
+};
+
+static ProfileFrame g_frames[PROFILER_HISTORY];
+static int          g_frameHead = 0;
+static int          g_frameCount = 0;
+
+static ProfileFrame g_current;
+static uint64_t     g_frameStart = 0;
+static uint64_t     g_zoneStart[PROFILE_ZONE_COUNT];
+
+static const char* traceName(ProfileZone zone) {
+    const char* name = ZONE_NAMES[zone];
+    while (*name == ' ') name++;
+    return name;
+}
+
+static float nsToMs(uint64_t ns) {
+    return (float)((double)ns / 1e6);
+}
+
+static int compareFloats(const void* a, const void* b) {
+    const float fa = *(const float*)a;
+    const float fb = *(const float*)b;
+    return (fa > fb) - (fa < fb);
+}
+
+static const ProfileFrame* frameAt(int age) {
+    int index = g_frameHead - 1 - age;
+    if (index < 0) index += PROFILER_HISTORY;
+    return &g_frames[index];
+}
+
+static void computeStats(float* samples, int count, ProfileStats* stats) {
+    memset(stats, 0, sizeof(*stats));
+    if (count == 0) return;
+
+    double sum = 0.0;
+    for (int i = 0; i < count; i++) {
+        sum += samples[i];
+    }
+
+    qsort(samples, (size_t)count, sizeof(float), compareFloats);
+
+    int p99Index = (count * 99 + 99) / 100 - 1;
+    if (p99Index < 0) p99Index = 0;
+
+    stats->minMs = samples[0];
+    stats->avgMs = (float)(sum / count);
+    stats->p99Ms = samples[p99Index];
+    stats->maxMs = samples[count - 1];
+}
+
+void Profiler_beginFrame(void) {
+    memset(&g_current, 0, sizeof(g_current));
+    g_frameStart = timeNowNs();
+    Trace_begin("Frame", "frame");
+}
+
+void Profiler_endFrame(void) {
+    if (g_frameStart == 0) return;
+    Trace_end("Frame", "frame");
+
+    g_current.frameMs = nsToMs(timeNowNs() - g_frameStart);
+    FlightRecorder_endFrame(g_current.zoneMs, g_current.frameMs);
+
+    g_frames[g_frameHead] = g_current;
+    g_frameHead = (g_frameHead + 1) % PROFILER_HISTORY;
+    if (g_frameCount < PROFILER_HISTORY) g_frameCount++;
+}
+
+void Profiler_begin(ProfileZone zone) {
+    Trace_begin(traceName(zone), "frame");
+    HwCounters_zoneBegin(zone);
+    g_zoneStart[zone] = timeNowNs();
+}
+
+void Profiler_end(ProfileZone zone) {
+    g_current.zoneMs[zone] += nsToMs(timeNowNs() - g_zoneStart[zone]);
+    HwCounters_zoneEnd(zone);
+    Trace_end(traceName(zone), "frame");
+}
+
+const char* Profiler_zoneName(ProfileZone zone) {
+    if (zone < 0 || zone >= PROFILE_ZONE_COUNT) return "?";
+    return ZONE_NAMES[zone];
+}
+
+int Profiler_frameCount(void) {
+    return g_frameCount;
+}
+
+void Profiler_getZoneStats(ProfileZone zone, ProfileStats* stats) {
+    float samples[PROFILER_HISTORY];
+    for (int i = 0; i < g_frameCount; i++) {
+        samples[i] = frameAt(i)->zoneMs[zone];
+    }
+    computeStats(samples, g_frameCount, stats);
+}
+
+void Profiler_getFrameStats(ProfileStats* stats) {
+    float samples[PROFILER_HISTORY];
+    for (int i = 0; i < g_frameCount; i++) {
+        samples[i] = frameAt(i)->frameMs;
+    }
+    computeStats(samples, g_frameCount, stats);
+}
+
+int Profiler_getFrameHistory(float* frameMs, int maxFrames) {
+    const int count = g_frameCount < maxFrames ? g_frameCount : maxFrames;
+    for (int i = 0; i < count; i++) {
+        frameMs[count - 1 - i] = frameAt(i)->frameMs;
+    }
+    return count;
+}
+
+float Profiler_lastZoneMs(ProfileZone zone) {
+    if (g_frameCount == 0) return 0.0f;
+    return frameAt(0)->zoneMs[zone];
+}
@@ -1,5 +1,30 @@
 #include "render.h"
 #include "assets.h"
+#include "trace.h"
+#include "flightrecorder.h"
+#include "utils.h"
+#include "renderstats.h"
+#include "loader.h"
+#include "startupreport.h"
+#include "text.h"
+#include "framebuffer.h"
+
+typedef struct {
+    SDL_Texture* texture;
+    SDL_Surface* pixels;
+    bool         keyed;
+    bool         opaque;
+    bool         target;
+} TextureShadow;
+
+typedef struct {
+    Framebuffer    view;
+    TextureShadow* shadow;
+    float          scale[2];
+} Canvas;
+
+static Framebuffer   s_screen;
+static TextureShadow s_shadows[TEXTURE_SHADOW_CAPACITY];
 
 void initSDL(void) {
     if (SDL_Init(SDL_INIT_VIDEO) < 0) {
@@ -19,7 +44,7 @@ SDL_Window* createWindow(const char* windowName, const int windowWidth, const in
         windowName,
         SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED,
         windowWidth, windowHeight,
-        SDL_WINDOW_SHOWN
+        SDL_WINDOW_SHOWN | SDL_WINDOW_RESIZABLE
     );
 
     if (window == NULL) {
@@ -44,6 +69,30 @@ SDL_Renderer* createRenderer(SDL_Window* window) {
         exit(EXIT_FAILURE);
     }
 
+    SDL_RenderSetLogicalSize(renderer, WINDOW_WIDTH, WINDOW_HEIGHT);
+    return renderer;
+}
+
+static Framebuffer surfaceView(SDL_Surface* surface) {
+    return (Framebuffer){(uint32_t*)surface->pixels, surface->w, surface->h, surface->pitch / 4};
+}
+
+SDL_Renderer* createSoftwareRenderer(RenderState* render) {
+    render->framebuffer = SDL_CreateRGBSurfaceWithFormat(0, WINDOW_WIDTH, WINDOW_HEIGHT, 32,
+                                                         SDL_PIXELFORMAT_ARGB8888);
+    SDL_Renderer* renderer = render->framebuffer ? SDL_CreateSoftwareRenderer(render->framebuffer) : NULL;
+
+    if (renderer == NULL) {
+        fprintf(stderr, "Erreur SDL_CreateSoftwareRenderer : %s\n", SDL_GetError());
+        destroyFramebuffer(render);
+        SDL_DestroyWindow(render->window);
+        SDL_Quit();
+        exit(EXIT_FAILURE);
+    }
+
+    s_screen = surfaceView(render->framebuffer);
+    printf("Rendu logiciel %dx%d (noyaux %s)\n", WINDOW_WIDTH, WINDOW_HEIGHT,
+           Framebuffer_simdName(Framebuffer_getSimd()));
     return renderer;
 }
 
@@ -58,146 +107,785 @@ void quitSDL(SDL_Window* window, SDL_Renderer* renderer) {
     SDL_Quit();
 }
 
-void updateDisplay(SDL_Renderer* renderer) {
-    SDL_RenderPresent(renderer);
+void destroyFramebuffer(RenderState* render) {
+    for (int i = 0; i < TEXTURE_SHADOW_CAPACITY; i++) {
+        if (s_shadows[i].pixels != NULL) SDL_FreeSurface(s_shadows[i].pixels);
+        s_shadows[i] = (TextureShadow){0};
+    }
+    s_screen = (Framebuffer){0};
+
+    if (render->framebuffer != NULL) {
+        SDL_FreeSurface(render->framebuffer);
+        render->framebuffer = NULL;
+    }
+    Framebuffer_shutdown();
 }
 
-void clearRenderer(SDL_Renderer* renderer) {
-    SDL_RenderClear(renderer);
+static SDL_Rect presentRect(RenderScaleMode mode, int width, int height) {
+    float scale = (float)width / WINDOW_WIDTH;
+    if ((float)height / WINDOW_HEIGHT < scale) scale = (float)height / WINDOW_HEIGHT;
+    if (mode == RENDER_SCALE_INTEGER && scale >= 1.0f) scale = (float)(int)scale;
+
+    SDL_Rect dst = {0, 0, (int)(WINDOW_WIDTH * scale), (int)(WINDOW_HEIGHT * scale)};
+    dst.x = (width - dst.w) / 2;
+    dst.y = (height - dst.h) / 2;
+    return dst;
 }
 
-SDL_Texture* loadTexture(const char* filePath, SDL_Renderer* renderer) {
-    const char* resolvedPath = asset_full(filePath);
-    SDL_Surface* surface = SDL_LoadBMP(resolvedPath);
-    if (surface == NULL) {
-        fprintf(stderr, "Erreur LoadBMP (%s) : %s\n", resolvedPath, SDL_GetError());
-        return NULL;
+static void presentFramebuffer(const RenderState* render) {
+    SDL_Surface* screen = render->window ? SDL_GetWindowSurface(render->window) : NULL;
+    if (screen == NULL) return;
+
+    const SDL_Rect dst = presentRect(render->scaleMode, screen->w, screen->h);
+    if (dst.w != screen->w || dst.h != screen->h) {
+        SDL_FillRect(screen, NULL, SDL_MapRGB(screen->format, 0, 0, 0));
     }
 
-    SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
-    SDL_FreeSurface(surface);
+    const Uint32 format = screen->format->format;
+    if ((format == SDL_PIXELFORMAT_ARGB8888 || format == SDL_PIXELFORMAT_RGB888) && SDL_LockSurface(screen) == 0) {
+        const Framebuffer source = surfaceView(render->framebuffer);
+        Framebuffer target = surfaceView(screen);
+        Framebuffer_blitScaled(&source, &target, dst.x, dst.y, dst.w, dst.h);
+        SDL_UnlockSurface(screen);
+    } else {
+        SDL_Rect scaled = dst;
+        SDL_BlitScaled(render->framebuffer, NULL, screen, &scaled);
+    }
 
-    if (texture == NULL) {
-        fprintf(stderr, "Erreur CreateTextureFromSurface : %s\n", SDL_GetError());
+    SDL_UpdateWindowSurface(render->window);
+}
+
+void updateDisplay(const RenderState* render) {
+    SDL_RenderPresent(render->renderer);
+    if (render->framebuffer != NULL) {
+        presentFramebuffer(render);
     }
+}
 
-    return texture;
+bool saveScreenshot(const RenderState* render, const char* path) {
+    if (render->framebuffer == NULL) {
+        fprintf(stderr, "Capture d'ecran disponible uniquement avec le rendu logiciel\n");
+        return false;
+    }
+    if (SDL_SaveBMP(render->framebuffer, path) != 0) {
+        fprintf(stderr, "Erreur capture d'ecran (%s) : %s\n", path, SDL_GetError());
+        return false;
+    }
+
+    printf("Capture d'ecran : %s\n", path);
+    return true;
 }
 
-void renderTexture(SDL_Texture* texture, SDL_Renderer* renderer,
-                   const int x, const int y, const int width, const int height) {
-    SDL_Rect dst = { x, y, width, height };
-    SDL_RenderCopy(renderer, texture, NULL, &dst);
+void setScaleMode(RenderState* render, RenderScaleMode mode) {
+    render->scaleMode = mode;
+    SDL_RenderSetIntegerScale(render->renderer, mode == RENDER_SCALE_INTEGER ? SDL_TRUE : SDL_FALSE);
 }
 
-SDL_Texture** loadTileTextures(const char* tileFilename, SDL_Renderer* renderer) {
-    const char* resolvedPath = asset_full(tileFilename);
-    SDL_Surface* atlas = SDL_LoadBMP(resolvedPath);
-    if (atlas == NULL) {
-        fprintf(stderr, "Erreur LoadBMP tiles (%s) : %s\n", resolvedPath, SDL_GetError());
-        return NULL;
+bool beginWorldPass(RenderState* render) {
+    if (render->world == NULL && !render->worldDirect) {
+        if (SDL_RenderTargetSupported(render->renderer)) {
+            render->world = renderCreateTargetTexture(render->renderer, WORLD_NATIVE_WIDTH, WORLD_NATIVE_HEIGHT);
+        }
+        if (render->world == NULL) {
+            fprintf(stderr, "Framebuffer natif indisponible, rendu direct : %s\n", SDL_GetError());
+            render->worldDirect = true;
+            return false;
+        }
+        SDL_SetTextureScaleMode(render->world, SDL_ScaleModeNearest);
     }
+    if (render->worldDirect) return false;
 
-    const int tileCount = MAP_TILES_WIDTH * MAP_TILES_HEIGHT;
-    SDL_Texture** textures = malloc(tileCount * sizeof(SDL_Texture*));
-    if (textures == NULL) {
-        SDL_FreeSurface(atlas);
-        return NULL;
+    if (SDL_SetRenderTarget(render->renderer, render->world) != 0) {
+        render->worldDirect = true;
+        return false;
     }
 
-    int index = 0;
-    for (int row = 0; row < MAP_TILES_HEIGHT; row++) {
-        for (int col = 0; col < MAP_TILES_WIDTH; col++) {
+    SDL_RenderSetScale(render->renderer, WORLD_NATIVE_SCALE, WORLD_NATIVE_SCALE);
+    clearRenderer(render->renderer);
+    return true;
+}
 
-            SDL_Surface* tileSurface = SDL_CreateRGBSurface(
-                0, MAP_TILE_SIZE, MAP_TILE_SIZE, 32, 0, 0, 0, 0
-            );
-            if (tileSurface == NULL) {
-                fprintf(stderr, "Erreur SDL_CreateRGBSurface pour tuile (%d,%d) : %s\n", row, col, SDL_GetError());
-                textures[index] = NULL;
-                index++;
-                continue;
-            }
+static SDL_Rect worldRect(RenderScaleMode mode) {
+    const int gameHeight = WINDOW_HEIGHT - WINDOW_TEXTAREA_HEIGHT;
+    SDL_Rect dst = {0, 0, WINDOW_WIDTH, gameHeight};
+    if (mode == RENDER_SCALE_INTEGER) {
+        int factor = WINDOW_WIDTH / WORLD_NATIVE_WIDTH;
+        if (gameHeight / WORLD_NATIVE_HEIGHT < factor) factor = gameHeight / WORLD_NATIVE_HEIGHT;
+        if (factor < 1) factor = 1;
+
+        dst.w = WORLD_NATIVE_WIDTH * factor;
+        dst.h = WORLD_NATIVE_HEIGHT * factor;
+        dst.x = (WINDOW_WIDTH - dst.w) / 2;
+        dst.y = (gameHeight - dst.h) / 2;
+    }
+    return dst;
+}
 
-            SDL_Rect srcRect = {
-                .x = col * (MAP_TILE_SIZE + 1) + 1,
-                .y = row * (MAP_TILE_SIZE + 1) + 1,
-                .w = MAP_TILE_SIZE,
-                .h = MAP_TILE_SIZE
-            };
-
-            if (SDL_BlitSurface(atlas, &srcRect, tileSurface, NULL) < 0) {
-                fprintf(stderr, "Erreur SDL_BlitSurface pour tuile (%d,%d) : %s\n", row, col, SDL_GetError());
-                SDL_FreeSurface(tileSurface);
-                textures[index] = NULL;
-                index++;
-                continue;
-            }
+void endWorldPass(RenderState* render) {
+    if (render->world == NULL || render->worldDirect) return;
+
+    SDL_SetRenderTarget(render->renderer, NULL);
+    const SDL_Rect dst = worldRect(render->scaleMode);
+    renderCopy(render->renderer, render->world, NULL, &dst);
+}
+
+void destroyWorldTarget(RenderState* render) {
+    renderDestroyTexture(render->world);
+    render->world = NULL;
+}
+
+static long rectArea(const SDL_Rect* rect) {
+    if (rect == NULL) return (long)WINDOW_WIDTH * WINDOW_HEIGHT;
+    return (long)rect->w * rect->h;
+}
+
+static long targetArea(SDL_Renderer* renderer) {
+    int width = WINDOW_WIDTH;
+    int height = WINDOW_HEIGHT;
+    SDL_Texture* target = SDL_GetRenderTarget(renderer);
+    if (target != NULL) SDL_QueryTexture(target, NULL, NULL, &width, &height);
+    return (long)width * height;
+}
+
+static uint32_t packColor(Uint8 r, Uint8 g, Uint8 b, Uint8 a) {
+    return (uint32_t)a << 24 | (uint32_t)r << 16 | (uint32_t)g << 8 | b;
+}
+
+static uint32_t drawColor(SDL_Renderer* renderer) {
+    Uint8 r, g, b, a;
+    SDL_GetRenderDrawColor(renderer, &r, &g, &b, &a);
+    return packColor(r, g, b, a);
+}
+
+static uint32_t textureTint(SDL_Texture* texture) {
+    Uint8 r, g, b, a;
+    SDL_GetTextureColorMod(texture, &r, &g, &b);
+    SDL_GetTextureAlphaMod(texture, &a);
+    return packColor(r, g, b, a);
+}
+
+static TextureShadow* findShadow(SDL_Texture* texture) {
+    if (texture == NULL) return NULL;
+    for (int i = 0; i < TEXTURE_SHADOW_CAPACITY; i++) {
+        if (s_shadows[i].texture == texture) return &s_shadows[i];
+    }
+    return NULL;
+}
 
-            SDL_Texture* tex = SDL_CreateTextureFromSurface(renderer, tileSurface);
-            SDL_FreeSurface(tileSurface);
-            if (tex == NULL) {
-                fprintf(stderr, "Erreur CreateTextureFromSurface pour tuile (%d,%d) : %s\n", row, col, SDL_GetError());
+static void scanAlpha(TextureShadow* shadow) {
+    const SDL_Surface* pixels = shadow->pixels;
+    bool keyed = true;
+    bool opaque = true;
+    for (int y = 0; y < pixels->h && keyed; y++) {
+        const uint32_t* line = (const uint32_t*)((const Uint8*)pixels->pixels + y * pixels->pitch);
+        for (int x = 0; x < pixels->w; x++) {
+            const uint32_t alpha = line[x] >> 24;
+            if (alpha != 255) opaque = false;
+            if (alpha != 0 && alpha != 255) {
+                keyed = false;
+                break;
             }
-            textures[index] = tex;
-            index++;
         }
     }
 
-    SDL_FreeSurface(atlas);
-    return textures;
+    shadow->keyed = keyed;
+    shadow->opaque = keyed && opaque;
 }
 
-void loadWorldMap(const char* filePath, int worldMap[GRID_WORLD_HEIGHT][GRID_WORLD_WIDTH]) {
-    const char* resolvedPath = asset_full(filePath);
-    FILE* file = fopen(resolvedPath, "r");
-    if (file == NULL) {
-        fprintf(stderr, "Erreur ouverture fichier : %s\n", resolvedPath);
-        exit(EXIT_FAILURE);
+static TextureShadow* addShadow(SDL_Texture* texture, SDL_Surface* pixels) {
+    if (pixels == NULL) return NULL;
+
+    for (int i = 0; i < TEXTURE_SHADOW_CAPACITY; i++) {
+        if (s_shadows[i].texture != NULL) continue;
+        s_shadows[i] = (TextureShadow){texture, pixels, false, false, false};
+        scanAlpha(&s_shadows[i]);
+        return &s_shadows[i];
+    }
+
+    SDL_FreeSurface(pixels);
+    return NULL;
+}
+
+static void removeShadow(SDL_Texture* texture) {
+    TextureShadow* shadow = findShadow(texture);
+    if (shadow == NULL) return;
+
+    SDL_FreeSurface(shadow->pixels);
+    *shadow = (TextureShadow){0};
+}
+
+static bool shadowView(const TextureShadow* shadow, const SDL_Rect* area, Framebuffer* view) {
+    const SDL_Surface* pixels = shadow->pixels;
+    const SDL_Rect full = {0, 0, pixels->w, pixels->h};
+    const SDL_Rect rect = area ? *area : full;
+    if (rect.x < 0 || rect.y < 0 || rect.w <= 0 || rect.h <= 0 ||
+        rect.x + rect.w > pixels->w || rect.y + rect.h > pixels->h) {
+        return false;
+    }
+
+    const int stride = pixels->pitch / 4;
+    *view = (Framebuffer){(uint32_t*)pixels->pixels + (size_t)rect.y * stride + rect.x, rect.w, rect.h, stride};
+    return true;
+}
+
+static void uploadShadow(const TextureShadow* shadow) {
+    SDL_UpdateTexture(shadow->texture, NULL, shadow->pixels->pixels, shadow->pixels->pitch);
+}
+
+static void downloadShadow(SDL_Renderer* renderer, TextureShadow* shadow) {
+    float scale[2];
+    SDL_RenderGetScale(renderer, &scale[0], &scale[1]);
+    SDL_RenderSetScale(renderer, 1.0f, 1.0f);
+
+    const SDL_Rect area = {0, 0, shadow->pixels->w, shadow->pixels->h};
+    SDL_RenderReadPixels(renderer, &area, SDL_PIXELFORMAT_ARGB8888, shadow->pixels->pixels, shadow->pixels->pitch);
+    SDL_RenderSetScale(renderer, scale[0], scale[1]);
+    scanAlpha(shadow);
+}
+
+static TextureShadow* beginFallback(SDL_Renderer* renderer, SDL_Texture* texture) {
+    const TextureShadow* source = findShadow(texture);
+    if (source != NULL && source->target) uploadShadow(source);
+
+    TextureShadow* canvas = findShadow(SDL_GetRenderTarget(renderer));
+    if (canvas != NULL) uploadShadow(canvas);
+    return canvas;
+}
+
+static void endFallback(SDL_Renderer* renderer, TextureShadow* canvas) {
+    if (canvas != NULL) downloadShadow(renderer, canvas);
+}
+
+static int scaledLength(int length, float scale) {
+    return (int)((float)length * scale + 0.5f);
+}
+
+static bool currentCanvas(SDL_Renderer* renderer, Canvas* canvas) {
+    if (s_screen.pixels == NULL || SDL_RenderIsClipEnabled(renderer)) return false;
+
+    SDL_Texture* target = SDL_GetRenderTarget(renderer);
+    canvas->shadow = findShadow(target);
+    if (target != NULL && canvas->shadow == NULL) return false;
+    canvas->view = canvas->shadow ? surfaceView(canvas->shadow->pixels) : s_screen;
+
+    SDL_RenderGetScale(renderer, &canvas->scale[0], &canvas->scale[1]);
+    SDL_Rect viewport;
+    SDL_RenderGetViewport(renderer, &viewport);
+    return viewport.x == 0 && viewport.y == 0 &&
+           scaledLength(viewport.w, canvas->scale[0]) == canvas->view.width &&
+           scaledLength(viewport.h, canvas->scale[1]) == canvas->view.height;
+}
+
+static bool isUnscaled(const Canvas* canvas) {
+    return canvas->scale[0] == 1.0f && canvas->scale[1] == 1.0f;
+}
+
+static SDL_Rect canvasRect(const Canvas* canvas, const SDL_Rect* rect) {
+    if (rect == NULL) return (SDL_Rect){0, 0, canvas->view.width, canvas->view.height};
+    if (isUnscaled(canvas)) return *rect;
+
+    return (SDL_Rect){
+        (int)((float)rect->x * canvas->scale[0]), (int)((float)rect->y * canvas->scale[1]),
+        (int)((float)rect->w * canvas->scale[0]), (int)((float)rect->h * canvas->scale[1])
+    };
+}
+
+static void beginCanvas(SDL_Renderer* renderer, const Canvas* canvas) {
+    if (canvas->shadow == NULL) SDL_RenderFlush(renderer);
+}
+
+static bool canBlend(const Canvas* canvas) {
+    return canvas->shadow == NULL || canvas->shadow->opaque;
+}
+
+static void markCanvas(const Canvas* canvas, const SDL_Rect* area, bool opaque) {
+    TextureShadow* shadow = canvas->shadow;
+    if (shadow == NULL) return;
+
+    if (!opaque) {
+        shadow->opaque = false;
+    } else if (area->x <= 0 && area->y <= 0 &&
+               area->x + area->w >= canvas->view.width && area->y + area->h >= canvas->view.height) {
+        shadow->opaque = true;
+    }
+    shadow->keyed = shadow->opaque;
+}
+
+static bool isSupportedBlend(SDL_BlendMode blend) {
+    return blend == SDL_BLENDMODE_NONE || blend == SDL_BLENDMODE_BLEND;
+}
+
+static bool fillAllowed(const Canvas* canvas, uint32_t color, SDL_BlendMode blend) {
+    return isSupportedBlend(blend) && (blend == SDL_BLENDMODE_NONE || color >> 24 == 255 || canBlend(canvas));
+}
+
+static bool spriteAllowed(const Canvas* canvas, const TextureShadow* shadow, uint32_t tint, SDL_BlendMode blend) {
+    if (blend == SDL_BLENDMODE_NONE) return tint == 0xFFFFFFFFu;
+    if (blend != SDL_BLENDMODE_BLEND) return false;
+    return canBlend(canvas) || (shadow->keyed && tint >> 24 == 255);
+}
+
+static void fillDirect(const Canvas* canvas, const SDL_Rect* area, uint32_t color, SDL_BlendMode blend) {
+    Framebuffer target = canvas->view;
+    if (blend == SDL_BLENDMODE_NONE || color >> 24 == 255) {
+        Framebuffer_fillRect(&target, area->x, area->y, area->w, area->h, color);
+        markCanvas(canvas, area, color >> 24 == 255);
+    } else {
+        Framebuffer_blendRect(&target, area->x, area->y, area->w, area->h, color);
+    }
+}
+
+static void spriteDirect(const Canvas* canvas, const TextureShadow* shadow, const Framebuffer* source,
+                         const SDL_Rect* area, uint32_t tint, SDL_BlendMode blend) {
+    Framebuffer target = canvas->view;
+    if (blend == SDL_BLENDMODE_NONE || (shadow->opaque && tint == 0xFFFFFFFFu)) {
+        Framebuffer_blitScaled(source, &target, area->x, area->y, area->w, area->h);
+        markCanvas(canvas, area, shadow->opaque);
+    } else if (shadow->keyed && tint >> 24 == 255) {
+        Framebuffer_blitKeyed(source, &target, area->x, area->y, area->w, area->h, tint);
+    } else {
+        Framebuffer_blitBlend(source, &target, area->x, area->y, area->w, area->h, tint);
+    }
+}
+
+static bool clearDirect(SDL_Renderer* renderer) {
+    Canvas canvas;
+    if (!currentCanvas(renderer, &canvas)) return false;
+
+    const SDL_Rect area = {0, 0, canvas.view.width, canvas.view.height};
+    beginCanvas(renderer, &canvas);
+    fillDirect(&canvas, &area, drawColor(renderer), SDL_BLENDMODE_NONE);
+    return true;
+}
+
+static bool copyDirect(SDL_Renderer* renderer, SDL_Texture* texture, const SDL_Rect* src, const SDL_Rect* dst) {
+    const TextureShadow* shadow = findShadow(texture);
+    Framebuffer source;
+    Canvas canvas;
+    if (shadow == NULL || !shadowView(shadow, src, &source) || !currentCanvas(renderer, &canvas)) return false;
+
+    SDL_BlendMode blend;
+    SDL_GetTextureBlendMode(texture, &blend);
+    const uint32_t tint = textureTint(texture);
+    if (!spriteAllowed(&canvas, shadow, tint, blend)) return false;
+
+    const SDL_Rect area = canvasRect(&canvas, dst);
+    beginCanvas(renderer, &canvas);
+    spriteDirect(&canvas, shadow, &source, &area, tint, blend);
+    return true;
+}
+
+static bool fillRectDirect(SDL_Renderer* renderer, const SDL_Rect* rect) {
+    Canvas canvas;
+    if (!currentCanvas(renderer, &canvas)) return false;
+
+    SDL_BlendMode blend;
+    SDL_GetRenderDrawBlendMode(renderer, &blend);
+    const uint32_t color = drawColor(renderer);
+    if (!fillAllowed(&canvas, color, blend)) return false;
+
+    const SDL_Rect area = canvasRect(&canvas, rect);
+    beginCanvas(renderer, &canvas);
+    fillDirect(&canvas, &area, color, blend);
+    return true;
+}
+
+static bool edgesDirect(SDL_Renderer* renderer, const SDL_Rect* edges, int count) {
+    Canvas canvas;
+    if (!currentCanvas(renderer, &canvas) || !isUnscaled(&canvas)) return false;
+
+    SDL_BlendMode blend;
+    SDL_GetRenderDrawBlendMode(renderer, &blend);
+    const uint32_t color = drawColor(renderer);
+    if (!fillAllowed(&canvas, color, blend)) return false;
+
+    beginCanvas(renderer, &canvas);
+    for (int i = 0; i < count; i++) {
+        if (edges[i].w > 0 && edges[i].h > 0) fillDirect(&canvas, &edges[i], color, blend);
+    }
+    return true;
+}
+
+static bool quadRect(const SDL_Vertex* quad, SDL_Rect* rect) {
+    const float left = quad[0].position.x;
+    const float top = quad[0].position.y;
+    const float right = quad[3].position.x;
+    const float bottom = quad[3].position.y;
+    if (quad[1].position.x != right || quad[1].position.y != top ||
+        quad[2].position.x != left || quad[2].position.y != bottom ||
+        left != (float)(int)left || top != (float)(int)top ||
+        right != (float)(int)right || bottom != (float)(int)bottom) {
+        return false;
+    }
+
+    for (int i = 1; i < 4; i++) {
+        if (memcmp(&quad[i].color, &quad[0].color, sizeof(SDL_Color)) != 0) return false;
+    }
+
+    *rect = (SDL_Rect){(int)left, (int)top, (int)(right - left), (int)(bottom - top)};
+    return true;
+}
+
+static bool texelCoordinate(float coordinate, int size, int* texel) {
+    const float scaled = coordinate * (float)size;
+    if (scaled < 0.0f) return false;
+
+    *texel = (int)(scaled + 0.5f);
+    const float error = scaled - (float)*texel;
+    return error < 0.01f && error > -0.01f;
+}
+
+static bool quadSource(const SDL_Vertex* quad, const SDL_Surface* pixels, SDL_Rect* source) {
+    if (quad[0].tex_coord.x != quad[2].tex_coord.x || quad[1].tex_coord.x != quad[3].tex_coord.x ||
+        quad[0].tex_coord.y != quad[1].tex_coord.y || quad[2].tex_coord.y != quad[3].tex_coord.y) {
+        return false;
+    }
+
+    int texels[4];
+    if (!texelCoordinate(quad[0].tex_coord.x, pixels->w, &texels[0]) ||
+        !texelCoordinate(quad[0].tex_coord.y, pixels->h, &texels[1]) ||
+        !texelCoordinate(quad[3].tex_coord.x, pixels->w, &texels[2]) ||
+        !texelCoordinate(quad[3].tex_coord.y, pixels->h, &texels[3])) {
+        return false;
+    }
+
+    *source = (SDL_Rect){texels[0], texels[1], texels[2] - texels[0], texels[3] - texels[1]};
+    return true;
+}
+
+static bool isQuadList(const int* indices, int vertexCount, int indexCount) {
+    static const int QUAD_INDICES[6] = {0, 1, 2, 2, 1, 3};
+
+    if (indices == NULL || vertexCount % 4 != 0 || indexCount != vertexCount / 4 * 6) return false;
+    for (int i = 0; i < indexCount; i++) {
+        if (indices[i] != i / 6 * 4 + QUAD_INDICES[i % 6]) return false;
     }
+    return true;
+}
+
+static uint32_t vertexColor(const SDL_Vertex* vertex) {
+    return packColor(vertex->color.r, vertex->color.g, vertex->color.b, vertex->color.a);
+}
 
-    char buffer[1024];
-    int row = 0;
+static bool geometryDirect(SDL_Renderer* renderer, SDL_Texture* texture, const SDL_Vertex* vertices,
+                           int vertexCount, const int* indices, int indexCount) {
+    const TextureShadow* shadow = findShadow(texture);
+    Canvas canvas;
+    if ((texture != NULL && (shadow == NULL || textureTint(texture) != 0xFFFFFFFFu)) ||
+        !isQuadList(indices, vertexCount, indexCount) || !currentCanvas(renderer, &canvas)) {
+        return false;
+    }
 
-    while (row < GRID_WORLD_HEIGHT && fgets(buffer, sizeof(buffer), file) != NULL) {
-        int col = 0;
-        char* token = strtok(buffer, " \t\r\n");
+    SDL_BlendMode blend;
+    if (texture != NULL) {
+        SDL_GetTextureBlendMode(texture, &blend);
+    } else {
+        SDL_GetRenderDrawBlendMode(renderer, &blend);
+    }
 
-        while (token != NULL && col < GRID_WORLD_WIDTH) {
-            worldMap[row][col] = (int)strtol(token, NULL, 16);
-            token = strtok(NULL, " \t\r\n");
-            col++;
+    SDL_Rect rect, source;
+    Framebuffer view;
+    for (int i = 0; i < vertexCount; i += 4) {
+        const uint32_t color = vertexColor(&vertices[i]);
+        if (!quadRect(&vertices[i], &rect)) return false;
+        if (shadow == NULL) {
+            if (!fillAllowed(&canvas, color, blend)) return false;
+        } else if (!spriteAllowed(&canvas, shadow, color, blend) ||
+                   !quadSource(&vertices[i], shadow->pixels, &source) ||
+                   !shadowView(shadow, &source, &view)) {
+            return false;
         }
-        row++;
     }
 
-    fclose(file);
+    beginCanvas(renderer, &canvas);
+    for (int i = 0; i < vertexCount; i += 4) {
+        const uint32_t color = vertexColor(&vertices[i]);
+        quadRect(&vertices[i], &rect);
+        const SDL_Rect area = canvasRect(&canvas, &rect);
+        if (shadow == NULL) {
+            fillDirect(&canvas, &area, color, blend);
+            continue;
+        }
+
+        quadSource(&vertices[i], shadow->pixels, &source);
+        shadowView(shadow, &source, &view);
+        spriteDirect(&canvas, shadow, &view, &area, color, blend);
+    }
+    return true;
 }
 
-void loadBlockingMap(const char* filePath, char blockingMap[GRID_WORLD_HEIGHT][GRID_WORLD_WIDTH]) {
-    const char* resolvedPath = asset_full(filePath);
-    FILE* file = fopen(resolvedPath, "r");
-    if (file == NULL) {
-        fprintf(stderr, "Erreur ouverture fichier : %s\n", resolvedPath);
-        exit(EXIT_FAILURE);
+void clearRenderer(SDL_Renderer* renderer) {
+    RenderStats_countDraw(targetArea(renderer));
+    if (clearDirect(renderer)) return;
+
+    TextureShadow* canvas = beginFallback(renderer, NULL);
+    SDL_RenderClear(renderer);
+    endFallback(renderer, canvas);
+}
+
+int renderCopy(SDL_Renderer* renderer, SDL_Texture* texture, const SDL_Rect* src, const SDL_Rect* dst) {
+    RenderStats_countBind(texture);
+    RenderStats_countDraw(rectArea(dst));
+    if (copyDirect(renderer, texture, src, dst)) return 0;
+
+    TextureShadow* canvas = beginFallback(renderer, texture);
+    const int result = SDL_RenderCopy(renderer, texture, src, dst);
+    endFallback(renderer, canvas);
+    return result;
+}
+
+int renderFillRect(SDL_Renderer* renderer, const SDL_Rect* rect) {
+    RenderStats_countDraw(rectArea(rect));
+    if (fillRectDirect(renderer, rect)) return 0;
+
+    TextureShadow* canvas = beginFallback(renderer, NULL);
+    const int result = SDL_RenderFillRect(renderer, rect);
+    endFallback(renderer, canvas);
+    return result;
+}
+
+int renderDrawRect(SDL_Renderer* renderer, const SDL_Rect* rect) {
+    const long perimeter = rect ? 2L * (rect->w + rect->h) : 2L * (WINDOW_WIDTH + WINDOW_HEIGHT);
+    RenderStats_countDraw(perimeter);
+    if (rect != NULL && rect->w > 0 && rect->h > 0) {
+        const SDL_Rect edges[4] = {
+            {rect->x, rect->y, rect->w, 1},
+            {rect->x, rect->y + rect->h - 1, rect->w, rect->h > 1 ? 1 : 0},
+            {rect->x, rect->y + 1, 1, rect->h - 2},
+            {rect->x + rect->w - 1, rect->y + 1, rect->w > 1 ? 1 : 0, rect->h - 2}
+        };
+        if (edgesDirect(renderer, edges, 4)) return 0;
+    }
+
+    TextureShadow* canvas = beginFallback(renderer, NULL);
+    const int result = SDL_RenderDrawRect(renderer, rect);
+    endFallback(renderer, canvas);
+    return result;
+}
+
+int renderDrawLine(SDL_Renderer* renderer, int x1, int y1, int x2, int y2) {
+    const int dx = x2 > x1 ? x2 - x1 : x1 - x2;
+    const int dy = y2 > y1 ? y2 - y1 : y1 - y2;
+    RenderStats_countDraw((long)(dx > dy ? dx : dy) + 1);
+    if (dx == 0 || dy == 0) {
+        const SDL_Rect line = {x1 < x2 ? x1 : x2, y1 < y2 ? y1 : y2, dx + 1, dy + 1};
+        if (edgesDirect(renderer, &line, 1)) return 0;
+    }
+
+    TextureShadow* canvas = beginFallback(renderer, NULL);
+    const int result = SDL_RenderDrawLine(renderer, x1, y1, x2, y2);
+    endFallback(renderer, canvas);
+    return result;
+}
+
+int renderGeometry(SDL_Renderer* renderer, SDL_Texture* texture, const SDL_Vertex* vertices, int vertexCount,
+                   const int* indices, int indexCount, long pixels) {
+    if (texture != NULL) RenderStats_countBind(texture);
+    RenderStats_countDraw(pixels);
+    if (geometryDirect(renderer, texture, vertices, vertexCount, indices, indexCount)) return 0;
+
+    TextureShadow* canvas = beginFallback(renderer, texture);
+    const int result = SDL_RenderGeometry(renderer, texture, vertices, vertexCount, indices, indexCount);
+    endFallback(renderer, canvas);
+    return result;
+}
+
+int renderSetColorMod(SDL_Texture* texture, Uint8 r, Uint8 g, Uint8 b) {
+    RenderStats_countColorMod();
+    return SDL_SetTextureColorMod(texture, r, g, b);
+}
+
+int renderUpdateTexture(SDL_Texture* texture, const SDL_Rect* rect, const void* pixels, int pitch) {
+    TextureShadow* shadow = findShadow(texture);
+    if (shadow != NULL && shadow->target) uploadShadow(shadow);
+
+    const int result = SDL_UpdateTexture(texture, rect, pixels, pitch);
+    if (result != 0 || shadow == NULL) return result;
+
+    Uint32 format;
+    Framebuffer view;
+    if (SDL_QueryTexture(texture, &format, NULL, NULL, NULL) != 0 || !shadowView(shadow, rect, &view) ||
+        SDL_ConvertPixels(view.width, view.height, format, pixels, pitch,
+                          SDL_PIXELFORMAT_ARGB8888, view.pixels, view.stride * (int)sizeof(uint32_t)) != 0) {
+        removeShadow(texture);
+        return result;
+    }
+
+    scanAlpha(shadow);
+    return result;
+}
+
+SDL_Texture* renderCreateTexture(SDL_Renderer* renderer, SDL_Surface* surface) {
+    SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
+    if (texture != NULL) {
+        RenderStats_countTextureCreated();
+        if (s_screen.pixels != NULL) {
+            addShadow(texture, SDL_ConvertSurfaceFormat(surface, SDL_PIXELFORMAT_ARGB8888, 0));
+        }
+    }
+    return texture;
+}
+
+SDL_Texture* renderCreateTargetTexture(SDL_Renderer* renderer, int width, int height) {
+    SDL_Texture* texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888,
+                                             SDL_TEXTUREACCESS_TARGET, width, height);
+    if (texture != NULL) {
+        RenderStats_countTextureCreated();
+        TextureShadow* shadow = s_screen.pixels == NULL ? NULL :
+            addShadow(texture, SDL_CreateRGBSurfaceWithFormat(0, width, height, 32, SDL_PIXELFORMAT_ARGB8888));
+        if (shadow != NULL) shadow->target = true;
+    }
+    return texture;
+}
+
+void renderDestroyTexture(SDL_Texture* texture) {
+    if (texture == NULL) return;
+    RenderStats_countTextureDestroyed();
+    removeShadow(texture);
+    SDL_DestroyTexture(texture);
+}
+
+SDL_RWops* openAssetRW(const char* filePath) {
+    const void* data;
+    size_t size;
+    if (asset_find(filePath, &data, &size) && size <= INT32_MAX) {
+        return SDL_RWFromConstMem(data, (int)size);
+    }
+    return SDL_RWFromFile(asset_full(filePath), "rb");
+}
+
+static SDL_Surface* decodeBMP(const char* filePath) {
+    SDL_Surface* preloaded = Loader_takeSurface(filePath);
+    if (preloaded != NULL) return preloaded;
+
+    Trace_begin("decode", "asset");
+    const uint64_t start = timeNowNs();
+    SDL_Surface* surface = SDL_LoadBMP_RW(openAssetRW(filePath), 1);
+    if (StartupReport_isEnabled()) {
+        StartupReport_addDecode(filePath, asset_size(filePath), timeNowNs() - start);
+    }
+    Trace_end("decode", "asset");
+    return surface;
+}
+
+static SDL_Texture* uploadSurface(SDL_Renderer* renderer, SDL_Surface* surface, const char* filePath) {
+    Trace_begin("upload", "asset");
+    const uint64_t start = timeNowNs();
+    SDL_Texture* texture = renderCreateTexture(renderer, surface);
+    StartupReport_addUpload(filePath, timeNowNs() - start);
+    Trace_end("upload", "asset");
+    return texture;
+}
+
+static SDL_Texture* loadTextureFile(const char* filePath, SDL_Renderer* renderer) {
+    SDL_Surface* surface = decodeBMP(filePath);
+    if (surface == NULL) {
+        fprintf(stderr, "Erreur LoadBMP (%s) : %s\n", asset_full(filePath), SDL_GetError());
+        return NULL;
+    }
+
+    SDL_Texture* texture = uploadSurface(renderer, surface, filePath);
+    SDL_FreeSurface(surface);
+
+    if (texture == NULL) {
+        fprintf(stderr, "Erreur CreateTextureFromSurface : %s\n", SDL_GetError());
     }
 
-    char buffer[512];
-    int row = 0;
+    return texture;
+}
+
+SDL_Texture* loadTexture(const char* filePath, SDL_Renderer* renderer) {
+    Trace_beginDetail("loadTexture", "asset", filePath);
+    const uint64_t start = timeNowNs();
+    SDL_Texture* texture = loadTextureFile(filePath, renderer);
+    FlightRecorder_noteAsset(filePath, timeNowNs() - start);
+    Trace_end("loadTexture", "asset");
+    return texture;
+}
+
+typedef struct {
+    char         path[TEXTURE_CACHE_PATH_SIZE];
+    SDL_Texture* texture;
+    int          refCount;
+} TextureCacheEntry;
+
+static TextureCacheEntry s_textureCache[TEXTURE_CACHE_CAPACITY];
+
+static TextureCacheEntry* cacheEntry(TextureHandle handle) {
+    if (handle <= TEXTURE_HANDLE_NONE || handle > TEXTURE_CACHE_CAPACITY) return NULL;
+    TextureCacheEntry* entry = &s_textureCache[handle - 1];
+    return entry->refCount > 0 ? entry : NULL;
+}
+
+TextureHandle textureCacheAcquire(const char* path, SDL_Renderer* renderer) {
+    if (path == NULL || renderer == NULL) return TEXTURE_HANDLE_NONE;
 
-    while (row < GRID_WORLD_HEIGHT && fgets(buffer, sizeof(buffer), file) != NULL) {
-        for (int col = 0; col < GRID_WORLD_WIDTH && buffer[col] != '\0' && buffer[col] != '\n'; col++) {
-            blockingMap[row][col] = buffer[col];
+    int freeSlot = -1;
+    for (int i = 0; i < TEXTURE_CACHE_CAPACITY; i++) {
+        TextureCacheEntry* entry = &s_textureCache[i];
+        if (entry->refCount == 0) {
+            if (freeSlot < 0) freeSlot = i;
+            continue;
+        }
+        if (strcmp(entry->path, path) == 0) {
+            entry->refCount++;
+            return i + 1;
         }
-        row++;
     }
 
-    fclose(file);
+    if (freeSlot < 0) {
+        fprintf(stderr, "Cache de textures plein (%d entrees) : %s\n", TEXTURE_CACHE_CAPACITY, path);
+        return TEXTURE_HANDLE_NONE;
+    }
+    if (strlen(path) >= TEXTURE_CACHE_PATH_SIZE) {
+        fprintf(stderr, "Chemin de texture trop long : %s\n", path);
+        return TEXTURE_HANDLE_NONE;
+    }
+
+    SDL_Texture* texture = loadTexture(path, renderer);
+    if (texture == NULL) return TEXTURE_HANDLE_NONE;
+
+    TextureCacheEntry* entry = &s_textureCache[freeSlot];
+    strcpy(entry->path, path);
+    entry->texture = texture;
+    entry->refCount = 1;
+    return freeSlot + 1;
+}
+
+SDL_Texture* textureCacheGet(TextureHandle handle) {
+    const TextureCacheEntry* entry = cacheEntry(handle);
+    return entry ? entry->texture : NULL;
+}
+
+void textureCacheRelease(TextureHandle handle) {
+    TextureCacheEntry* entry = cacheEntry(handle);
+    if (entry == NULL) return;
+
+    entry->refCount--;
+    if (entry->refCount == 0) {
+        renderDestroyTexture(entry->texture);
+        entry->texture = NULL;
+        entry->path[0] = '\0';
+    }
+}
+
+int textureCacheCount(void) {
+    int count = 0;
+    for (int i = 0; i < TEXTURE_CACHE_CAPACITY; i++) {
+        if (s_textureCache[i].refCount > 0) count++;
+    }
+    return count;
+}
+
+void renderTexture(SDL_Texture* texture, SDL_Renderer* renderer,
+                   const int x, const int y, const int width, const int height) {
+    SDL_Rect dst = { x, y, width, height };
+    renderCopy(renderer, texture, NULL, &dst);
 }
 
 void printText(const int x, const int y, const char* text,
                const int width, const int height, SDL_Renderer* renderer) {
-    TTF_Font* font = TTF_OpenFont(asset_full(WINDOW_FONT_PATH), WINDOW_FONT_SIZE);
+    TTF_Font* font = TTF_OpenFontRW(openAssetRW(WINDOW_FONT_PATH), 1, WINDOW_FONT_SIZE);
     if (font == NULL) {
         fprintf(stderr, "Erreur chargement police : %s\n", TTF_GetError());
         return;
@@ -210,11 +898,11 @@ void printText(const int x, const int y, const char* text,
         return;
     }
 
-    SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
+    SDL_Texture* texture = renderCreateTexture(renderer, surface);
     if (texture != NULL) {
         SDL_Rect rect = { x, y, width, height };
-        SDL_RenderCopy(renderer, texture, NULL, &rect);
-        SDL_DestroyTexture(texture);
+        renderCopy(renderer, texture, NULL, &rect);
+        renderDestroyTexture(texture);
     }
 
     SDL_FreeSurface(surface);
@@ -225,16 +913,5 @@ void printTextWithFont(int x, int y, const char* text, TTF_Font* font, SDL_Rende
     if (font == NULL || text == NULL || renderer == NULL) return;
 
     SDL_Color color = {255, 255, 0, 255};
-    SDL_Surface* surface = TTF_RenderText_Blended_Wrapped(font, text, color, 400);
-    if (surface == NULL) return;
-
-
-    SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
-    if (texture != NULL) {
-        SDL_Rect rect = { x, y, surface->w, surface->h };
-        SDL_RenderCopy(renderer, texture, NULL, &rect);
-        SDL_DestroyTexture(texture);
-    }
-
-    SDL_FreeSurface(surface);
+    Text_draw(renderer, font, x, y, text, color);
 }
@@ -0,0 +1,178 @@
+#include "renderqueue.h"
+
+static SDL_Renderer*  s_renderer = NULL;
+static RenderCommand* s_commands = NULL;
+static SDL_Vertex*    s_vertices = NULL;
+static int*           s_indices = NULL;
+static int            s_capacity = 0;
+static int            s_commandCount = 0;
+
+static int compareCommands(const void* a, const void* b) {
+    const RenderCommand* left = a;
+    const RenderCommand* right = b;
+
+    if (left->layer != right->layer) return left->layer < right->layer ? -1 : 1;
+    return left->sequence - right->sequence;
+}
+
+static bool reserveCommands(int count) {
+    if (count <= s_capacity) return true;
+
+    int newCapacity = s_capacity > 0 ? s_capacity : RENDER_QUEUE_MIN_CAPACITY;
+    while (newCapacity < count) newCapacity *= 2;
+
+    RenderCommand* commands = realloc(s_commands, (size_t)newCapacity * sizeof(RenderCommand));
+    if (commands == NULL) return false;
+    s_commands = commands;
+
+    SDL_Vertex* vertices = realloc(s_vertices, (size_t)newCapacity * 4 * sizeof(SDL_Vertex));
+    if (vertices == NULL) return false;
+    s_vertices = vertices;
+
+    int* indices = realloc(s_indices, (size_t)newCapacity * 6 * sizeof(int));
+    if (indices == NULL) return false;
+    s_indices = indices;
+
+    static const int QUAD_INDICES[6] = {0, 1, 2, 2, 1, 3};
+    for (int quad = s_capacity; quad < newCapacity; quad++) {
+        for (int i = 0; i < 6; i++) {
+            s_indices[quad * 6 + i] = quad * 4 + QUAD_INDICES[i];
+        }
+    }
+
+    s_capacity = newCapacity;
+    return true;
+}
+
+static void pushCommand(RenderLayer layer, SDL_Texture* texture, const SDL_Rect* source,
+                        const SDL_Rect* dst, SDL_Color color, SDL_BlendMode blend) {
+    if (!reserveCommands(s_commandCount + 1)) {
+        fprintf(stderr, "File de rendu : memoire insuffisante, commande ignoree\n");
+        return;
+    }
+
+    RenderCommand* command = &s_commands[s_commandCount];
+    command->texture = texture;
+    command->source = source ? *source : (SDL_Rect){0, 0, 0, 0};
+    command->dst = *dst;
+    command->color = color;
+    command->blend = blend;
+    command->layer = layer;
+    command->pass = RenderStats_getPass();
+    command->sequence = s_commandCount;
+    s_commandCount++;
+}
+
+void RenderQueue_begin(SDL_Renderer* renderer) {
+    s_renderer = renderer;
+    s_commandCount = 0;
+}
+
+void RenderQueue_sprite(RenderLayer layer, SDL_Texture* texture, const SDL_Rect* source,
+                        const SDL_Rect* dst, SDL_Color tint) {
+    if (texture == NULL || dst == NULL) return;
+    pushCommand(layer, texture, source, dst, tint, SDL_BLENDMODE_BLEND);
+}
+
+void RenderQueue_fillRect(RenderLayer layer, const SDL_Rect* rect, SDL_Color color, SDL_BlendMode blend) {
+    if (rect == NULL || rect->w <= 0 || rect->h <= 0) return;
+    pushCommand(layer, NULL, NULL, rect, color, blend);
+}
+
+void RenderQueue_drawRect(RenderLayer layer, const SDL_Rect* rect, SDL_Color color, SDL_BlendMode blend) {
+    if (rect == NULL || rect->w <= 0 || rect->h <= 0) return;
+
+    const SDL_Rect edges[4] = {
+        {rect->x, rect->y, rect->w, 1},
+        {rect->x, rect->y + rect->h - 1, rect->w, 1},
+        {rect->x, rect->y + 1, 1, rect->h - 2},
+        {rect->x + rect->w - 1, rect->y + 1, 1, rect->h - 2}
+    };
+    for (int i = 0; i < 4; i++) {
+        RenderQueue_fillRect(layer, &edges[i], color, blend);
+    }
+}
+
+static void writeQuad(SDL_Vertex* vertices, const RenderCommand* command, const int textureSize[2]) {
+    const float left = (float)command->dst.x;
+    const float top = (float)command->dst.y;
+    const float right = (float)(command->dst.x + command->dst.w);
+    const float bottom = (float)(command->dst.y + command->dst.h);
+
+    float u0 = 0.0f, v0 = 0.0f, u1 = 0.0f, v1 = 0.0f;
+    if (command->texture != NULL) {
+        const SDL_Rect* source = &command->source;
+        if (source->w > 0 && source->h > 0) {
+            u0 = (float)source->x / (float)textureSize[0];
+            v0 = (float)source->y / (float)textureSize[1];
+            u1 = (float)(source->x + source->w) / (float)textureSize[0];
+            v1 = (float)(source->y + source->h) / (float)textureSize[1];
+        } else {
+            u1 = 1.0f;
+            v1 = 1.0f;
+        }
+    }
+
+    vertices[0] = (SDL_Vertex){{left, top}, command->color, {u0, v0}};
+    vertices[1] = (SDL_Vertex){{right, top}, command->color, {u1, v0}};
+    vertices[2] = (SDL_Vertex){{left, bottom}, command->color, {u0, v1}};
+    vertices[3] = (SDL_Vertex){{right, bottom}, command->color, {u1, v1}};
+}
+
+static void drawBatch(const RenderCommand* first, int count) {
+    int textureSize[2] = {1, 1};
+    if (first->texture != NULL) {
+        SDL_QueryTexture(first->texture, NULL, NULL, &textureSize[0], &textureSize[1]);
+        SDL_SetTextureBlendMode(first->texture, first->blend);
+    } else {
+        SDL_SetRenderDrawBlendMode(s_renderer, first->blend);
+    }
+
+    long pixels = 0;
+    for (int i = 0; i < count; i++) {
+        writeQuad(&s_vertices[i * 4], &first[i], textureSize);
+        pixels += (long)first[i].dst.w * first[i].dst.h;
+    }
+
+    RenderStats_setPass(first->pass);
+    renderGeometry(s_renderer, first->texture, s_vertices, count * 4, s_indices, count * 6, pixels);
+}
+
+void RenderQueue_flush(void) {
+    if (s_renderer == NULL || s_commandCount == 0) {
+        s_commandCount = 0;
+        return;
+    }
+
+    qsort(s_commands, (size_t)s_commandCount, sizeof(RenderCommand), compareCommands);
+
+    const RenderPass pass = RenderStats_getPass();
+    int start = 0;
+    for (int i = 1; i <= s_commandCount; i++) {
+        const RenderCommand* first = &s_commands[start];
+        const bool breaks = i == s_commandCount ||
+                            s_commands[i].layer != first->layer ||
+                            s_commands[i].blend != first->blend ||
+                            s_commands[i].texture != first->texture ||
+                            s_commands[i].pass != first->pass;
+        if (!breaks) continue;
+
+        drawBatch(first, i - start);
+        start = i;
+    }
+    RenderStats_setPass(pass);
+
+    s_commandCount = 0;
+}
+
+void RenderQueue_shutdown(void) {
+    free(s_commands);
+    free(s_vertices);
+    free(s_indices);
+    s_commands = NULL;
+    s_vertices = NULL;
+    s_indices = NULL;
+    s_capacity = 0;
+    s_commandCount = 0;
+    s_renderer = NULL;
+}
@@ -0,0 +1,75 @@
+#include "renderstats.h"
+
+static const char* PASS_NAMES[RENDER_PASS_COUNT] = {
+    [RENDER_PASS_MAP]      = "Carte",
+    [RENDER_PASS_ENTITIES] = "Entites",
+    [RENDER_PASS_HUD]      = "HUD",
+    [RENDER_PASS_MENU]     = "Menu",
+    [RENDER_PASS_DEBUG]    = "Debug"
+};
+
+static RenderCounters g_current[RENDER_PASS_COUNT];
+static RenderCounters g_last[RENDER_PASS_COUNT];
+static RenderPass     g_pass = RENDER_PASS_MAP;
+static const void*    g_boundTexture = NULL;
+
+void RenderStats_beginFrame(void) {
+    memset(g_current, 0, sizeof(g_current));
+    g_boundTexture = NULL;
+}
+
+void RenderStats_endFrame(void) {
+    memcpy(g_last, g_current, sizeof(g_last));
+}
+
+void RenderStats_setPass(RenderPass pass) {
+    g_pass = pass;
+}
+
+RenderPass RenderStats_getPass(void) {
+    return g_pass;
+}
+
+void RenderStats_countDraw(long pixels) {
+    g_current[g_pass].drawCalls++;
+    g_current[g_pass].pixelsFilled += pixels;
+}
+
+void RenderStats_countBind(const void* texture) {
+    if (texture == g_boundTexture) return;
+    g_boundTexture = texture;
+    g_current[g_pass].textureBinds++;
+}
+
+void RenderStats_countColorMod(void) {
+    g_current[g_pass].colorMods++;
+}
+
+void RenderStats_countTextureCreated(void) {
+    g_current[g_pass].texturesCreated++;
+}
+
+void RenderStats_countTextureDestroyed(void) {
+    g_current[g_pass].texturesDestroyed++;
+}
+
+const char* RenderStats_passName(RenderPass pass) {
+    if (pass < 0 || pass >= RENDER_PASS_COUNT) return "?";
+    return PASS_NAMES[pass];
+}
+
+const RenderCounters* RenderStats_getLastFrame(RenderPass pass) {
+    return &g_last[pass];
+}
+
+void RenderStats_getLastFrameTotal(RenderCounters* total) {
+    memset(total, 0, sizeof(*total));
+    for (int pass = 0; pass < RENDER_PASS_COUNT; pass++) {
+        total->drawCalls += g_last[pass].drawCalls;
+        total->textureBinds += g_last[pass].textureBinds;
+        total->colorMods += g_last[pass].colorMods;
+        total->texturesCreated += g_last[pass].texturesCreated;
+        total->texturesDestroyed += g_last[pass].texturesDestroyed;
+        total->pixelsFilled += g_last[pass].pixelsFilled;
+    }
+}
@@ -0,0 +1,170 @@
+#include "replay.h"
+
+#define REPLAY_HEADER_SIZE  16
+#define REPLAY_MIN_CAPACITY 1024
+
+static void writeU16(uint8_t* out, uint16_t value) {
+    out[0] = (uint8_t)(value & 0xFFu);
+    out[1] = (uint8_t)(value >> 8);
+}
+
+static void writeU32(uint8_t* out, uint32_t value) {
+    for (int i = 0; i < 4; i++) {
+        out[i] = (uint8_t)((value >> (i * 8)) & 0xFFu);
+    }
+}
+
+static uint16_t readU16(const uint8_t* in) {
+    return (uint16_t)(in[0] | (in[1] << 8));
+}
+
+static uint32_t readU32(const uint8_t* in) {
+    return (uint32_t)in[0] | ((uint32_t)in[1] << 8) |
+           ((uint32_t)in[2] << 16) | ((uint32_t)in[3] << 24);
+}
+
+static bool reserve(Replay* replay, int capacity) {
+    if (capacity <= replay->capacity) return true;
+
+    int newCapacity = replay->capacity > 0 ? replay->capacity : REPLAY_MIN_CAPACITY;
+    while (newCapacity < capacity) newCapacity *= 2;
+
+    uint8_t* inputs = realloc(replay->inputs, (size_t)newCapacity);
+    if (!inputs) return false;
+    replay->inputs = inputs;
+
+    uint32_t* hashes = realloc(replay->hashes, (size_t)newCapacity * sizeof(uint32_t));
+    if (!hashes) return false;
+    replay->hashes = hashes;
+
+    replay->capacity = newCapacity;
+    return true;
+}
+
+uint8_t Replay_packInput(const InputState* input) {
+    uint8_t bits = 0;
+    if (input->moveUp) bits |= REPLAY_INPUT_UP;
+    if (input->moveDown) bits |= REPLAY_INPUT_DOWN;
+    if (input->moveLeft) bits |= REPLAY_INPUT_LEFT;
+    if (input->moveRight) bits |= REPLAY_INPUT_RIGHT;
+    if (input->attack) bits |= REPLAY_INPUT_ATTACK;
+    if (input->interact) bits |= REPLAY_INPUT_INTERACT;
+    return bits;
+}
+
+void Replay_unpackInput(uint8_t bits, InputState* input) {
+    input->moveUp = (bits & REPLAY_INPUT_UP) != 0;
+    input->moveDown = (bits & REPLAY_INPUT_DOWN) != 0;
+    input->moveLeft = (bits & REPLAY_INPUT_LEFT) != 0;
+    input->moveRight = (bits & REPLAY_INPUT_RIGHT) != 0;
+    input->attack = (bits & REPLAY_INPUT_ATTACK) != 0;
+    input->interact = (bits & REPLAY_INPUT_INTERACT) != 0;
+}
+
+void Replay_init(Replay* replay, uint32_t seed) {
+    replay->seed = seed;
+    replay->count = 0;
+    replay->cursor = 0;
+}
+
+void Replay_free(Replay* replay) {
+    free(replay->inputs);
+    free(replay->hashes);
+    memset(replay, 0, sizeof(*replay));
+}
+
+bool Replay_record(Replay* replay, const InputState* input, uint32_t hash) {
+    if (!reserve(replay, replay->count + 1)) {
+        fprintf(stderr, "Replay : memoire insuffisante\n");
+        return false;
+    }
+
+    replay->inputs[replay->count] = Replay_packInput(input);
+    replay->hashes[replay->count] = hash;
+    replay->count++;
+    return true;
+}
+
+bool Replay_next(Replay* replay, InputState* input, uint32_t* expectedHash) {
+    if (replay->cursor >= replay->count) return false;
+
+    Replay_unpackInput(replay->inputs[replay->cursor], input);
+    if (expectedHash) {
+        *expectedHash = replay->hashes[replay->cursor];
+    }
+    replay->cursor++;
+    return true;
+}
+
+bool Replay_save(const Replay* replay, const char* path) {
+    FILE* file = fopen(path, "wb");
+    if (!file) {
+        fprintf(stderr, "Replay : impossible d'ecrire %s\n", path);
+        return false;
+    }
+
+    uint8_t header[REPLAY_HEADER_SIZE] = {0};
+    memcpy(header, REPLAY_MAGIC, 4);
+    writeU16(header + 4, REPLAY_VERSION);
+    writeU32(header + 8, replay->seed);
+    writeU32(header + 12, (uint32_t)replay->count);
+
+    bool ok = fwrite(header, 1, sizeof(header), file) == sizeof(header);
+    if (ok && replay->count > 0) {
+        ok = fwrite(replay->inputs, 1, (size_t)replay->count, file) == (size_t)replay->count;
+    }
+
+    for (int i = 0; ok && i < replay->count; i++) {
+        uint8_t bytes[4];
+        writeU32(bytes, replay->hashes[i]);
+        ok = fwrite(bytes, 1, sizeof(bytes), file) == sizeof(bytes);
+    }
+
+    if (fclose(file) != 0) ok = false;
+    if (!ok) {
+        fprintf(stderr, "Replay : ecriture incomplete de %s\n", path);
+    }
+    return ok;
+}
+
+bool Replay_load(Replay* replay, const char* path) {
+    FILE* file = fopen(path, "rb");
+    if (!file) {
+        fprintf(stderr, "Replay introuvable : %s\n", path);
+        return false;
+    }
+
+    uint8_t header[REPLAY_HEADER_SIZE];
+    if (fread(header, 1, sizeof(header), file) != sizeof(header) ||
+        memcmp(header, REPLAY_MAGIC, 4) != 0 ||
+        readU16(header + 4) != REPLAY_VERSION) {
+        fprintf(stderr, "Replay invalide : %s\n", path);
+        fclose(file);
+        return false;
+    }
+
+    const uint32_t count = readU32(header + 12);
+    Replay_init(replay, readU32(header + 8));
+
+    if (count > (uint32_t)INT32_MAX / 4 || !reserve(replay, (int)count)) {
+        fprintf(stderr, "Replay trop volumineux : %s\n", path);
+        fclose(file);
+        return false;
+    }
+
+    bool ok = count == 0 || fread(replay->inputs, 1, count, file) == count;
+    for (uint32_t i = 0; ok && i < count; i++) {
+        uint8_t bytes[4];
+        ok = fread(bytes, 1, sizeof(bytes), file) == sizeof(bytes);
+        replay->hashes[i] = readU32(bytes);
+    }
+    fclose(file);
+
+    if (!ok) {
+        fprintf(stderr, "Replay tronque : %s\n", path);
+        return false;
+    }
+
+    replay->count = (int)count;
+    return true;
+}
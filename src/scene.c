@@ -0,0 +1,378 @@
+#include "scene.h"
+#include "loader.h"
+#include "renderqueue.h"
+
+static int roundToInt(const float value) {
+    return (int)(value + (value >= 0.0f ? 0.5f : -0.5f));
+}
+
+static void drawGrid(SDL_Renderer* renderer) {
+    SDL_SetRenderDrawColor(renderer, 255, 255, 255, 80);
+
+    int gameHeight = WINDOW_HEIGHT - WINDOW_TEXTAREA_HEIGHT;
+
+    for (int row = 1; row < gameHeight / GRID_CELL_SIZE; row++) {
+        renderDrawLine(renderer,
+            0, row * GRID_CELL_SIZE,
+            WINDOW_WIDTH - 1, row * GRID_CELL_SIZE
+        );
+    }
+
+    for (int col = 1; col < WINDOW_WIDTH / GRID_CELL_SIZE; col++) {
+        renderDrawLine(renderer,
+            col * GRID_CELL_SIZE, 0,
+            col * GRID_CELL_SIZE, gameHeight - 1
+        );
+    }
+}
+
+void Scene_queueAssets(void) {
+    Loader_queueImage(ASSET_MAP_TILES);
+    SpriteSet_queueAssets();
+}
+
+static int onRenderReset(void* userdata, SDL_Event* event) {
+    if (event->type == SDL_RENDER_TARGETS_RESET || event->type == SDL_RENDER_DEVICE_RESET) {
+        ((Scene*)userdata)->roomCacheLost = true;
+    }
+    return 1;
+}
+
+void Scene_init(Scene* scene, SDL_Renderer* renderer) {
+    scene->renderer = renderer;
+
+    scene->tileAtlas = textureCacheAcquire(ASSET_MAP_TILES, renderer);
+    scene->tileVertices = malloc(SCENE_MAX_VISIBLE_TILES * 4 * sizeof(SDL_Vertex));
+    scene->tileIndices = malloc(SCENE_MAX_VISIBLE_TILES * 6 * sizeof(int));
+
+    SDL_Texture* atlas = textureCacheGet(scene->tileAtlas);
+    if (atlas == NULL || scene->tileVertices == NULL || scene->tileIndices == NULL) {
+        fprintf(stderr, "Erreur: impossible de charger les textures de la carte\n");
+        exit(EXIT_FAILURE);
+    }
+    SDL_QueryTexture(atlas, NULL, NULL, &scene->tileAtlasSize[0], &scene->tileAtlasSize[1]);
+
+    static const int QUAD_INDICES[6] = {0, 1, 2, 2, 1, 3};
+    for (int quad = 0; quad < SCENE_MAX_VISIBLE_TILES; quad++) {
+        for (int i = 0; i < 6; i++) {
+            scene->tileIndices[quad * 6 + i] = quad * 4 + QUAD_INDICES[i];
+        }
+    }
+
+    memset(scene->roomCache, 0, sizeof(scene->roomCache));
+    scene->roomFrame = 0;
+    scene->roomTargets = SDL_RenderTargetSupported(renderer);
+    scene->roomCacheLost = false;
+    if (scene->roomTargets) {
+        SDL_AddEventWatch(onRenderReset, scene);
+    }
+
+    SpriteSet_loadLink(&scene->linkSprites, renderer);
+    SpriteSet_loadEnemy(&scene->enemySprites, renderer);
+}
+
+static void clearRoomCache(Scene* scene) {
+    for (int i = 0; i < SCENE_ROOM_CACHE_SIZE; i++) {
+        renderDestroyTexture(scene->roomCache[i].texture);
+        scene->roomCache[i].texture = NULL;
+    }
+}
+
+void Scene_destroy(Scene* scene) {
+    SpriteSet_destroy(&scene->linkSprites);
+    SpriteSet_destroy(&scene->enemySprites);
+
+    if (scene->roomTargets) {
+        SDL_DelEventWatch(onRenderReset, scene);
+    }
+    clearRoomCache(scene);
+
+    textureCacheRelease(scene->tileAtlas);
+    scene->tileAtlas = TEXTURE_HANDLE_NONE;
+
+    free(scene->tileVertices);
+    free(scene->tileIndices);
+    scene->tileVertices = NULL;
+    scene->tileIndices = NULL;
+}
+
+static void writeQuad(SDL_Vertex* vertices, int x, int y, SDL_Color color, const float uv[4]) {
+    const float left = (float)x;
+    const float top = (float)y;
+    const float right = (float)(x + GRID_CELL_SIZE);
+    const float bottom = (float)(y + GRID_CELL_SIZE);
+
+    vertices[0] = (SDL_Vertex){{left, top}, color, {uv[0], uv[1]}};
+    vertices[1] = (SDL_Vertex){{right, top}, color, {uv[2], uv[1]}};
+    vertices[2] = (SDL_Vertex){{left, bottom}, color, {uv[0], uv[3]}};
+    vertices[3] = (SDL_Vertex){{right, bottom}, color, {uv[2], uv[3]}};
+}
+
+static void drawTiles(const Scene* scene, const Map* map, float originX, float originY,
+                      int startTileX, int startTileY, int endTileX, int endTileY) {
+    if (endTileX - startTileX > SCENE_VISIBLE_COLS) endTileX = startTileX + SCENE_VISIBLE_COLS;
+    if (endTileY - startTileY > SCENE_VISIBLE_ROWS) endTileY = startTileY + SCENE_VISIBLE_ROWS;
+
+    const float texelU = 1.0f / (float)scene->tileAtlasSize[0];
+    const float texelV = 1.0f / (float)scene->tileAtlasSize[1];
+    const SDL_Color white = {255, 255, 255, 255};
+    const SDL_Color magenta = {255, 0, 255, 255};
+    const float noUv[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+
+    int tileCount = 0;
+    int missingCount = 0;
+    SDL_Vertex* missing = scene->tileVertices + SCENE_MAX_VISIBLE_TILES * 4;
+
+    for (int row = startTileY; row < endTileY; row++) {
+        for (int col = startTileX; col < endTileX; col++) {
+            const Tile tile = map->world[row][col];
+            const int tileIndex = (int)tile.textureId;
+
+            int screenX = roundToInt(col * GRID_CELL_SIZE - originX);
+            int screenY = roundToInt(row * GRID_CELL_SIZE - originY);
+
+            if (tileIndex >= 0 && tileIndex < MAP_TILES_COUNT) {
+                const int atlasX = (tileIndex % MAP_TILES_WIDTH) * (MAP_TILE_SIZE + 1) + 1;
+                const int atlasY = (tileIndex / MAP_TILES_WIDTH) * (MAP_TILE_SIZE + 1) + 1;
+                const float uv[4] = {
+                    atlasX * texelU, atlasY * texelV,
+                    (atlasX + MAP_TILE_SIZE) * texelU, (atlasY + MAP_TILE_SIZE) * texelV
+                };
+                writeQuad(scene->tileVertices + tileCount * 4, screenX, screenY, white, uv);
+                tileCount++;
+            } else {
+                missingCount++;
+                writeQuad(missing - missingCount * 4, screenX, screenY, magenta, noUv);
+            }
+        }
+    }
+
+    const long cellPixels = (long)GRID_CELL_SIZE * GRID_CELL_SIZE;
+    if (tileCount > 0) {
+        renderGeometry(scene->renderer, textureCacheGet(scene->tileAtlas),
+                       scene->tileVertices, tileCount * 4,
+                       scene->tileIndices, tileCount * 6, tileCount * cellPixels);
+    }
+    if (missingCount > 0) {
+        renderGeometry(scene->renderer, NULL,
+                       missing - missingCount * 4, missingCount * 4,
+                       scene->tileIndices, missingCount * 6, missingCount * cellPixels);
+    }
+}
+
+static void drawVisibleTiles(const Scene* scene, const Map* map, const Camera* view) {
+    int gameHeight = WINDOW_HEIGHT - WINDOW_TEXTAREA_HEIGHT;
+
+    int startTileX = (int)(view->x / GRID_CELL_SIZE);
+    int startTileY = (int)(view->y / GRID_CELL_SIZE);
+    int endTileX = (int)((view->x + WINDOW_WIDTH) / GRID_CELL_SIZE) + 2;
+    int endTileY = (int)((view->y + gameHeight) / GRID_CELL_SIZE) + 2;
+
+    if (startTileX < 0) startTileX = 0;
+    if (startTileY < 0) startTileY = 0;
+    if (endTileX > GRID_WORLD_WIDTH) endTileX = GRID_WORLD_WIDTH;
+    if (endTileY > GRID_WORLD_HEIGHT) endTileY = GRID_WORLD_HEIGHT;
+
+    drawTiles(scene, map, view->x, view->y, startTileX, startTileY, endTileX, endTileY);
+}
+
+static SDL_Texture* bakeRoom(const Scene* scene, const Map* map, const Room* room) {
+    SDL_Texture* texture = renderCreateTargetTexture(scene->renderer,
+                                                     SCENE_ROOM_NATIVE_WIDTH, SCENE_ROOM_NATIVE_HEIGHT);
+    if (texture == NULL) return NULL;
+    SDL_SetTextureScaleMode(texture, SDL_ScaleModeNearest);
+
+    SDL_Texture* previous = SDL_GetRenderTarget(scene->renderer);
+    float previousScale[2];
+    SDL_RenderGetScale(scene->renderer, &previousScale[0], &previousScale[1]);
+    if (SDL_SetRenderTarget(scene->renderer, texture) != 0) {
+        renderDestroyTexture(texture);
+        return NULL;
+    }
+    SDL_RenderSetScale(scene->renderer, WORLD_NATIVE_SCALE, WORLD_NATIVE_SCALE);
+
+    Uint8 r, g, b, a;
+    SDL_GetRenderDrawColor(scene->renderer, &r, &g, &b, &a);
+    SDL_SetRenderDrawColor(scene->renderer, 0, 0, 0, 255);
+    clearRenderer(scene->renderer);
+    SDL_SetRenderDrawColor(scene->renderer, r, g, b, a);
+
+    drawTiles(scene, map,
+              (float)(room->startX * GRID_CELL_SIZE), (float)(room->startY * GRID_CELL_SIZE),
+              room->startX, room->startY,
+              room->startX + GRID_ROOM_WIDTH, room->startY + GRID_ROOM_HEIGHT);
+
+    SDL_SetRenderTarget(scene->renderer, previous);
+    if (previous != NULL) {
+        SDL_RenderSetScale(scene->renderer, previousScale[0], previousScale[1]);
+    }
+    return texture;
+}
+
+static RoomTexture* findRoom(Scene* scene, const int room[2]) {
+    for (int i = 0; i < SCENE_ROOM_CACHE_SIZE; i++) {
+        RoomTexture* entry = &scene->roomCache[i];
+        if (entry->texture != NULL && entry->room[0] == room[0] && entry->room[1] == room[1]) {
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+static RoomTexture* acquireRoom(Scene* scene, const Map* map, const int room[2]) {
+    RoomTexture* entry = findRoom(scene, room);
+    if (entry == NULL) {
+        entry = &scene->roomCache[0];
+        for (int i = 0; i < SCENE_ROOM_CACHE_SIZE && entry->texture != NULL; i++) {
+            RoomTexture* candidate = &scene->roomCache[i];
+            if (candidate->texture == NULL || candidate->lastUsed < entry->lastUsed) {
+                entry = candidate;
+            }
+        }
+
+        renderDestroyTexture(entry->texture);
+        entry->texture = bakeRoom(scene, map, &map->rooms[room[1]][room[0]]);
+        entry->room[0] = room[0];
+        entry->room[1] = room[1];
+        if (entry->texture == NULL) return NULL;
+    }
+
+    entry->lastUsed = scene->roomFrame;
+    return entry;
+}
+
+static bool isRoomInside(const int room[2]) {
+    return room[0] >= 0 && room[0] < GRID_WORLD_WIDTH / GRID_ROOM_WIDTH &&
+           room[1] >= 0 && room[1] < GRID_WORLD_HEIGHT / GRID_ROOM_HEIGHT;
+}
+
+static void prefetchNeighbours(Scene* scene, const Map* map) {
+    static const int OFFSETS[4][2] = {{1, 0}, {-1, 0}, {0, 1}, {0, -1}};
+
+    for (int i = 0; i < 4; i++) {
+        const int room[2] = {map->currentRoom[0] + OFFSETS[i][0], map->currentRoom[1] + OFFSETS[i][1]};
+        if (!isRoomInside(room)) continue;
+
+        RoomTexture* entry = findRoom(scene, room);
+        if (entry != NULL) {
+            entry->lastUsed = scene->roomFrame;
+            continue;
+        }
+
+        acquireRoom(scene, map, room);
+        return;
+    }
+}
+
+static int roomAt(float position, int roomSize) {
+    int room = (int)(position / roomSize);
+    if (position < (float)(room * roomSize)) room--;
+    return room;
+}
+
+static bool drawCachedRooms(Scene* scene, const Map* map, const Camera* view) {
+    const int gameHeight = WINDOW_HEIGHT - WINDOW_TEXTAREA_HEIGHT;
+    const int firstRoomX = roomAt(view->x, SCENE_ROOM_PIXEL_WIDTH);
+    const int firstRoomY = roomAt(view->y, SCENE_ROOM_PIXEL_HEIGHT);
+    const int lastRoomX = roomAt(view->x + WINDOW_WIDTH - 1, SCENE_ROOM_PIXEL_WIDTH);
+    const int lastRoomY = roomAt(view->y + gameHeight - 1, SCENE_ROOM_PIXEL_HEIGHT);
+
+    for (int roomY = firstRoomY; roomY <= lastRoomY; roomY++) {
+        for (int roomX = firstRoomX; roomX <= lastRoomX; roomX++) {
+            const int room[2] = {roomX, roomY};
+            if (!isRoomInside(room)) continue;
+
+            RoomTexture* entry = acquireRoom(scene, map, room);
+            if (entry == NULL) return false;
+
+            SDL_Rect dst = {
+                roundToInt(roomX * SCENE_ROOM_PIXEL_WIDTH - view->x),
+                roundToInt(roomY * SCENE_ROOM_PIXEL_HEIGHT - view->y),
+                SCENE_ROOM_PIXEL_WIDTH, SCENE_ROOM_PIXEL_HEIGHT
+            };
+            renderCopy(scene->renderer, entry->texture, NULL, &dst);
+        }
+    }
+
+    return true;
+}
+
+void Scene_drawMap(Scene* scene, const Map* map, bool showGrid, float alpha) {
+    Camera view;
+    Camera_interpolate(&map->camera, alpha, &view);
+
+    if (scene->roomCacheLost) {
+        clearRoomCache(scene);
+        scene->roomCacheLost = false;
+    }
+
+    scene->roomFrame++;
+    if (scene->roomTargets && drawCachedRooms(scene, map, &view)) {
+        prefetchNeighbours(scene, map);
+    } else {
+        scene->roomTargets = false;
+        drawVisibleTiles(scene, map, &view);
+    }
+
+    if (showGrid) {
+        drawGrid(scene->renderer);
+    }
+}
+
+void Scene_drawEnemy(const Scene* scene, const Enemy* enemy, const Camera* view, float alpha) {
+    if (!enemy->isActive) return;
+
+    if (enemy->hitTimer > 0 && (enemy->hitTimer / 3) % 2 == 0) {
+        return;
+    }
+
+    const SpriteFrame* frame = Animation_getCurrentFrame(&enemy->animation, &scene->enemySprites);
+    SDL_Texture* texture = frame ? textureCacheGet(frame->texture) : NULL;
+    if (!texture) return;
+
+    float renderPos[2];
+    Character_getRenderPos(&enemy->base, alpha, renderPos);
+
+    int screenPos[2];
+    Camera_worldToScreenF(view, renderPos[0], renderPos[1], screenPos);
+
+    const SDL_Color tint = enemy->hitTimer > 0 ? (SDL_Color){255, 100, 100, 255} : (SDL_Color){255, 255, 255, 255};
+    SDL_Rect dst = {screenPos[0], screenPos[1], GRID_CELL_SIZE, GRID_CELL_SIZE};
+    RenderQueue_sprite(RENDER_LAYER_ENTITIES, texture, &frame->source, &dst, tint);
+
+    int maxLives = Enemy_getMaxLives(enemy);
+    if (maxLives > 1) {
+        int barWidth = GRID_CELL_SIZE - 10;
+        int barHeight = 4;
+        int barX = screenPos[0] + 5;
+        int barY = screenPos[1] - 6;
+
+        SDL_Rect bgRect = {barX, barY, barWidth, barHeight};
+        RenderQueue_fillRect(RENDER_LAYER_ENTITY_UI, &bgRect, (SDL_Color){60, 60, 60, 255}, SDL_BLENDMODE_NONE);
+
+        int healthWidth = (enemy->base.lives * barWidth) / maxLives;
+        Uint8 r = (Uint8)(255 - (enemy->base.lives * 255 / maxLives));
+        Uint8 g = (Uint8)(enemy->base.lives * 255 / maxLives);
+        SDL_Rect healthRect = {barX, barY, healthWidth, barHeight};
+        RenderQueue_fillRect(RENDER_LAYER_ENTITY_UI, &healthRect, (SDL_Color){r, g, 0, 255}, SDL_BLENDMODE_NONE);
+
+        RenderQueue_drawRect(RENDER_LAYER_ENTITY_UI, &bgRect, (SDL_Color){255, 255, 255, 255}, SDL_BLENDMODE_NONE);
+    }
+}
+
+void Scene_drawLink(const Scene* scene, const Link* link, const Camera* view, float alpha) {
+    if (!link || !scene->renderer) return;
+    if (link->isInvincible && (link->invincibilityTimer / 5) % 2 == 0) return;
+
+    const SpriteFrame* frame = Animation_getCurrentFrame(&link->animation, &scene->linkSprites);
+    SDL_Texture* tex = frame ? textureCacheGet(frame->texture) : NULL;
+    if (!tex) return;
+
+    float renderPos[2];
+    Character_getRenderPos(&link->base, alpha, renderPos);
+
+    int screen[2];
+    Camera_worldToScreenF(view, renderPos[0], renderPos[1], screen);
+    SDL_Rect dst = {screen[0], screen[1], GRID_CELL_SIZE, GRID_CELL_SIZE};
+    RenderQueue_sprite(RENDER_LAYER_ENTITIES, tex, &frame->source, &dst, (SDL_Color){255, 255, 255, 255});
+}
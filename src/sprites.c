@@ -0,0 +1,151 @@
+#include "sprites.h"
+#include "loader.h"
+#include "assets.h"
+
+typedef struct {
+    char     path[TEXTURE_CACHE_PATH_SIZE];
+    SDL_Rect source;
+} AtlasEntry;
+
+static AtlasEntry s_atlasFrames[SPRITE_ATLAS_MAX_FRAMES];
+static int        s_atlasFrameCount = 0;
+static bool       s_atlasLoaded = false;
+
+static const char* LINK_WALK[4][2] = {
+    {"textures/characters/link0.bmp", "textures/characters/link1.bmp"},
+    {"textures/characters/link2.bmp", "textures/characters/link3.bmp"},
+    {"textures/characters/link4.bmp", "textures/characters/link5.bmp"},
+    {"textures/characters/link6.bmp", "textures/characters/link7.bmp"}
+};
+
+static const char* LINK_ATTACK[4] = {
+    "textures/characters/linkSwordRight.bmp",
+    "textures/characters/linkSwordUp.bmp",
+    "textures/characters/linkSwordLeft.bmp",
+    "textures/characters/linkSwordDown.bmp"
+};
+
+static const char* ENEMY_WALK[4][2] = {
+    {"textures/characters/enemy0.bmp", "textures/characters/enemy1.bmp"},
+    {"textures/characters/enemy2.bmp", "textures/characters/enemy3.bmp"},
+    {"textures/characters/enemy4.bmp", "textures/characters/enemy5.bmp"},
+    {"textures/characters/enemy6.bmp", "textures/characters/enemy7.bmp"}
+};
+
+static bool loadAtlasTable(void) {
+    if (s_atlasLoaded) return s_atlasFrameCount > 0;
+    s_atlasLoaded = true;
+
+    AssetData file;
+    if (!asset_load(ASSET_ATLAS_FRAMES, &file)) return false;
+
+    char line[256];
+    size_t cursor = 0;
+    while (s_atlasFrameCount < SPRITE_ATLAS_MAX_FRAMES && asset_readLine(&file, &cursor, line, sizeof(line))) {
+        if (line[0] == '#') continue;
+
+        AtlasEntry* entry = &s_atlasFrames[s_atlasFrameCount];
+        SDL_Rect* rect = &entry->source;
+        if (sscanf(line, "%127s %d %d %d %d", entry->path, &rect->x, &rect->y, &rect->w, &rect->h) == 5) {
+            s_atlasFrameCount++;
+        }
+    }
+
+    asset_release(&file);
+    return s_atlasFrameCount > 0;
+}
+
+static const AtlasEntry* findAtlasEntry(const char* path) {
+    if (!loadAtlasTable()) return NULL;
+
+    for (int i = 0; i < s_atlasFrameCount; i++) {
+        if (strcmp(s_atlasFrames[i].path, path) == 0) return &s_atlasFrames[i];
+    }
+    return NULL;
+}
+
+static void acquireFrame(SpriteFrame* frame, const char* path, SDL_Renderer* renderer) {
+    const AtlasEntry* entry = findAtlasEntry(path);
+    if (entry != NULL) {
+        frame->texture = textureCacheAcquire(ASSET_ATLAS_CHARACTERS, renderer);
+        frame->source = entry->source;
+        if (frame->texture != TEXTURE_HANDLE_NONE) return;
+    }
+
+    frame->texture = textureCacheAcquire(path, renderer);
+    frame->source = (SDL_Rect){0, 0, 0, 0};
+
+    SDL_Texture* texture = textureCacheGet(frame->texture);
+    if (texture != NULL) {
+        SDL_QueryTexture(texture, NULL, NULL, &frame->source.w, &frame->source.h);
+    }
+}
+
+static void releaseFrame(SpriteFrame* frame) {
+    textureCacheRelease(frame->texture);
+    frame->texture = TEXTURE_HANDLE_NONE;
+}
+
+const SpriteFrame* Animation_getCurrentFrame(const AnimationState* anim, const SpriteSet* sprites) {
+    if (!anim || !sprites) return NULL;
+
+    int dir = (int)anim->direction;
+
+    if (anim->state == ANIM_STATE_ATTACKING && sprites->attack[dir].texture != TEXTURE_HANDLE_NONE) {
+        return &sprites->attack[dir];
+    }
+    if (anim->state == ANIM_STATE_WALKING) {
+        return &sprites->walk[dir][anim->currentFrame % ANIM_WALK_FRAMES];
+    }
+    return &sprites->walk[dir][0];
+}
+
+void SpriteSet_queueAssets(void) {
+    if (loadAtlasTable()) {
+        Loader_queueImage(ASSET_ATLAS_CHARACTERS);
+        return;
+    }
+
+    for (int d = 0; d < 4; d++) {
+        for (int f = 0; f < ANIM_WALK_FRAMES; f++) {
+            Loader_queueImage(LINK_WALK[d][f]);
+            Loader_queueImage(ENEMY_WALK[d][f]);
+        }
+        Loader_queueImage(LINK_ATTACK[d]);
+    }
+}
+
+void SpriteSet_loadLink(SpriteSet* sprites, SDL_Renderer* renderer) {
+    if (!sprites || !renderer) return;
+    memset(sprites, 0, sizeof(SpriteSet));
+
+    for (int d = 0; d < 4; d++) {
+        for (int f = 0; f < ANIM_WALK_FRAMES; f++) {
+            acquireFrame(&sprites->walk[d][f], LINK_WALK[d][f], renderer);
+        }
+        acquireFrame(&sprites->attack[d], LINK_ATTACK[d], renderer);
+    }
+}
+
+void SpriteSet_loadEnemy(SpriteSet* sprites, SDL_Renderer* renderer) {
+    if (!sprites || !renderer) return;
+    memset(sprites, 0, sizeof(SpriteSet));
+
+    for (int d = 0; d < 4; d++) {
+        for (int f = 0; f < ANIM_WALK_FRAMES; f++) {
+            acquireFrame(&sprites->walk[d][f], ENEMY_WALK[d][f], renderer);
+        }
+        sprites->attack[d].texture = TEXTURE_HANDLE_NONE;
+    }
+}
+
+void SpriteSet_destroy(SpriteSet* sprites) {
+    if (!sprites) return;
+
+    for (int d = 0; d < 4; d++) {
+        for (int f = 0; f < ANIM_WALK_FRAMES; f++) {
+            releaseFrame(&sprites->walk[d][f]);
+        }
+        releaseFrame(&sprites->attack[d]);
+    }
+}
@@ -0,0 +1,148 @@
+#include "startupreport.h"
+#include "utils.h"
+
+#include <pthread.h>
+
+#define NS_PER_MS 1e6
+
+typedef struct {
+    char     name[STARTUP_NAME_SIZE];
+    uint64_t startNs;
+    uint64_t durationNs;
+} StartupStep;
+
+typedef struct {
+    char     name[STARTUP_NAME_SIZE];
+    long     bytes;
+    uint64_t decodeNs;
+    uint64_t uploadNs;
+} StartupAsset;
+
+static pthread_mutex_t g_lock = PTHREAD_MUTEX_INITIALIZER;
+static bool            g_enabled = false;
+static bool            g_ready = false;
+static uint64_t        g_originNs = 0;
+static uint64_t        g_firstFrameNs = 0;
+static uint64_t        g_readyFrameNs = 0;
+
+static StartupStep     g_steps[STARTUP_MAX_STEPS];
+static int             g_stepCount = 0;
+static StartupAsset    g_assets[STARTUP_MAX_ASSETS];
+static int             g_assetCount = 0;
+
+void StartupReport_enable(void) {
+    g_enabled = true;
+    g_originNs = timeNowNs();
+}
+
+bool StartupReport_isEnabled(void) {
+    return g_enabled;
+}
+
+void StartupReport_step(const char* name, uint64_t startNs) {
+    if (!g_enabled || !name) return;
+    const uint64_t endNs = timeNowNs();
+
+    pthread_mutex_lock(&g_lock);
+    if (g_stepCount < STARTUP_MAX_STEPS) {
+        StartupStep* step = &g_steps[g_stepCount++];
+        snprintf(step->name, sizeof(step->name), "%s", name);
+        step->startNs = startNs > g_originNs ? startNs - g_originNs : 0;
+        step->durationNs = endNs - startNs;
+    }
+    pthread_mutex_unlock(&g_lock);
+}
+
+static StartupAsset* findAsset(const char* name) {
+    for (int i = 0; i < g_assetCount; i++) {
+        if (strncmp(g_assets[i].name, name, STARTUP_NAME_SIZE - 1) == 0) return &g_assets[i];
+    }
+
+    if (g_assetCount >= STARTUP_MAX_ASSETS) return NULL;
+    StartupAsset* asset = &g_assets[g_assetCount++];
+    memset(asset, 0, sizeof(*asset));
+    snprintf(asset->name, sizeof(asset->name), "%s", name);
+    return asset;
+}
+
+void StartupReport_addDecode(const char* asset, long bytes, uint64_t durationNs) {
+    if (!g_enabled || !asset) return;
+
+    pthread_mutex_lock(&g_lock);
+    StartupAsset* entry = findAsset(asset);
+    if (entry && entry->decodeNs == 0) {
+        entry->bytes = bytes;
+        entry->decodeNs = durationNs;
+    }
+    pthread_mutex_unlock(&g_lock);
+}
+
+void StartupReport_addUpload(const char* asset, uint64_t durationNs) {
+    if (!g_enabled || !asset) return;
+
+    pthread_mutex_lock(&g_lock);
+    StartupAsset* entry = findAsset(asset);
+    if (entry) {
+        entry->uploadNs += durationNs;
+    }
+    pthread_mutex_unlock(&g_lock);
+}
+
+void StartupReport_markReady(void) {
+    g_ready = true;
+}
+
+void StartupReport_markFrame(void) {
+    if (!g_enabled || g_readyFrameNs > 0) return;
+
+    const uint64_t nowNs = timeNowNs() - g_originNs;
+    if (g_firstFrameNs == 0) g_firstFrameNs = nowNs;
+    if (g_ready) g_readyFrameNs = nowNs;
+}
+
+static int compareAssetCost(const void* a, const void* b) {
+    const StartupAsset* assetA = a;
+    const StartupAsset* assetB = b;
+    const uint64_t costA = assetA->decodeNs + assetA->uploadNs;
+    const uint64_t costB = assetB->decodeNs + assetB->uploadNs;
+    return (costA < costB) - (costA > costB);
+}
+
+void StartupReport_print(FILE* out) {
+    if (!g_enabled) return;
+
+    pthread_mutex_lock(&g_lock);
+    fprintf(out, "=== Demarrage ===\n");
+    fprintf(out, "%-28s %10s %10s\n", "etape", "debut ms", "duree ms");
+    for (int i = 0; i < g_stepCount; i++) {
+        const StartupStep* step = &g_steps[i];
+        fprintf(out, "%-28s %10.2f %10.2f\n", step->name,
+                step->startNs / NS_PER_MS, step->durationNs / NS_PER_MS);
+    }
+
+    qsort(g_assets, (size_t)g_assetCount, sizeof(StartupAsset), compareAssetCost);
+
+    long totalBytes = 0;
+    uint64_t totalDecodeNs = 0;
+    uint64_t totalUploadNs = 0;
+
+    fprintf(out, "\n%-40s %10s %10s %10s %10s\n", "asset", "octets", "decode ms", "upload ms", "total ms");
+    for (int i = 0; i < g_assetCount; i++) {
+        const StartupAsset* asset = &g_assets[i];
+        fprintf(out, "%-40s %10ld %10.2f %10.2f %10.2f\n", asset->name, asset->bytes,
+                asset->decodeNs / NS_PER_MS, asset->uploadNs / NS_PER_MS,
+                (asset->decodeNs + asset->uploadNs) / NS_PER_MS);
+        totalBytes += asset->bytes;
+        totalDecodeNs += asset->decodeNs;
+        totalUploadNs += asset->uploadNs;
+    }
+    fprintf(out, "%-40s %10ld %10.2f %10.2f %10.2f\n", "Total", totalBytes,
+            totalDecodeNs / NS_PER_MS, totalUploadNs / NS_PER_MS,
+            (totalDecodeNs + totalUploadNs) / NS_PER_MS);
+    pthread_mutex_unlock(&g_lock);
+
+    fprintf(out, "\npremiere frame : %.2f ms\n", g_firstFrameNs / NS_PER_MS);
+    if (g_readyFrameNs > 0) {
+        fprintf(out, "menu affiche   : %.2f ms\n", g_readyFrameNs / NS_PER_MS);
+    }
+}
@@ -0,0 +1,286 @@
+#include "text.h"
+
+typedef struct {
+    SDL_Rect source;
+    int      offsetX;
+    int      advance;
+} TextGlyph;
+
+typedef struct {
+    TTF_Font*    font;
+    SDL_Texture* texture;
+    int          atlasSize[2];
+    int          height;
+    int          lineSkip;
+    TextGlyph    glyphs[TEXT_GLYPH_COUNT];
+    signed char  kerning[TEXT_KERNING_COUNT][TEXT_KERNING_COUNT];
+} TextAtlas;
+
+static TextAtlas  s_atlases[TEXT_MAX_FONTS];
+static SDL_Vertex s_vertices[TEXT_MAX_QUADS * 4];
+static int        s_indices[TEXT_MAX_QUADS * 6];
+static bool       s_indicesReady = false;
+
+static int nextCodepoint(const char** cursor) {
+    const unsigned char* c = (const unsigned char*)*cursor;
+    int codepoint = c[0];
+    int extra = 0;
+
+    if (codepoint >= 0xF0) {
+        codepoint &= 0x07;
+        extra = 3;
+    } else if (codepoint >= 0xE0) {
+        codepoint &= 0x0F;
+        extra = 2;
+    } else if (codepoint >= 0xC0) {
+        codepoint &= 0x1F;
+        extra = 1;
+    }
+
+    for (int i = 1; i <= extra; i++) {
+        if ((c[i] & 0xC0) != 0x80) {
+            *cursor += 1;
+            return c[0];
+        }
+        codepoint = (codepoint << 6) | (c[i] & 0x3F);
+    }
+
+    *cursor += extra + 1;
+    return codepoint;
+}
+
+static int glyphIndex(int codepoint) {
+    if (codepoint < TEXT_FIRST_GLYPH || codepoint > TEXT_LAST_GLYPH) codepoint = '?';
+    return codepoint - TEXT_FIRST_GLYPH;
+}
+
+static int kerningBetween(const TextAtlas* atlas, int previous, int current) {
+    if (previous < TEXT_FIRST_GLYPH || previous > TEXT_KERNING_LAST) return 0;
+    if (current < TEXT_FIRST_GLYPH || current > TEXT_KERNING_LAST) return 0;
+    return atlas->kerning[previous - TEXT_FIRST_GLYPH][current - TEXT_FIRST_GLYPH];
+}
+
+static bool packGlyphs(TextAtlas* atlas, SDL_Surface* surfaces[TEXT_GLYPH_COUNT]) {
+    const SDL_Color white = {255, 255, 255, 255};
+    int x = 1;
+    int y = 1;
+    int shelfHeight = 0;
+
+    for (int i = 0; i < TEXT_GLYPH_COUNT; i++) {
+        const Uint16 codepoint = (Uint16)(TEXT_FIRST_GLYPH + i);
+        TextGlyph* glyph = &atlas->glyphs[i];
+
+        int minX = 0;
+        int advance = 0;
+        if (!TTF_GlyphIsProvided(atlas->font, codepoint) ||
+            TTF_GlyphMetrics(atlas->font, codepoint, &minX, NULL, NULL, NULL, &advance) != 0) {
+            glyph->advance = -1;
+            continue;
+        }
+
+        glyph->advance = advance;
+        glyph->offsetX = minX < 0 ? minX : 0;
+
+        surfaces[i] = TTF_RenderGlyph_Blended(atlas->font, codepoint, white);
+        if (surfaces[i] == NULL) continue;
+        if (surfaces[i]->w + 2 > TEXT_ATLAS_WIDTH) return false;
+
+        if (x + surfaces[i]->w + 1 > TEXT_ATLAS_WIDTH) {
+            x = 1;
+            y += shelfHeight + 1;
+            shelfHeight = 0;
+        }
+
+        glyph->source = (SDL_Rect){x, y, surfaces[i]->w, surfaces[i]->h};
+        x += surfaces[i]->w + 1;
+        if (surfaces[i]->h > shelfHeight) shelfHeight = surfaces[i]->h;
+    }
+
+    atlas->atlasSize[0] = TEXT_ATLAS_WIDTH;
+    atlas->atlasSize[1] = y + shelfHeight + 1;
+    return true;
+}
+
+static bool buildAtlas(TextAtlas* atlas, SDL_Renderer* renderer) {
+    SDL_Surface* surfaces[TEXT_GLYPH_COUNT] = {0};
+    bool ok = packGlyphs(atlas, surfaces);
+
+    SDL_Surface* sheet = ok ? SDL_CreateRGBSurfaceWithFormat(0, atlas->atlasSize[0], atlas->atlasSize[1],
+                                                             32, SDL_PIXELFORMAT_ARGB8888) : NULL;
+    ok = sheet != NULL;
+
+    for (int i = 0; i < TEXT_GLYPH_COUNT; i++) {
+        if (surfaces[i] == NULL) continue;
+        if (ok) {
+            SDL_Rect dst = atlas->glyphs[i].source;
+            SDL_SetSurfaceBlendMode(surfaces[i], SDL_BLENDMODE_NONE);
+            ok = SDL_BlitSurface(surfaces[i], NULL, sheet, &dst) == 0;
+        }
+        SDL_FreeSurface(surfaces[i]);
+    }
+
+    atlas->texture = ok ? renderCreateTexture(renderer, sheet) : NULL;
+    if (sheet != NULL) SDL_FreeSurface(sheet);
+    if (atlas->texture == NULL) return false;
+    SDL_SetTextureBlendMode(atlas->texture, SDL_BLENDMODE_BLEND);
+
+    const TextGlyph fallback = atlas->glyphs[glyphIndex('?')];
+    for (int i = 0; i < TEXT_GLYPH_COUNT; i++) {
+        if (atlas->glyphs[i].advance < 0) atlas->glyphs[i] = fallback;
+    }
+
+    for (int previous = 0; previous < TEXT_KERNING_COUNT; previous++) {
+        for (int current = 0; current < TEXT_KERNING_COUNT; current++) {
+            int kerning = TTF_GetFontKerningSizeGlyphs(atlas->font, (Uint16)(TEXT_FIRST_GLYPH + previous),
+                                                       (Uint16)(TEXT_FIRST_GLYPH + current));
+            if (kerning < -128) kerning = -128;
+            if (kerning > 127) kerning = 127;
+            atlas->kerning[previous][current] = (signed char)kerning;
+        }
+    }
+
+    atlas->height = TTF_FontHeight(atlas->font);
+    atlas->lineSkip = TTF_FontLineSkip(atlas->font);
+    return true;
+}
+
+static TextAtlas* findAtlas(TTF_Font* font) {
+    for (int i = 0; i < TEXT_MAX_FONTS; i++) {
+        if (s_atlases[i].font == font && s_atlases[i].texture != NULL) return &s_atlases[i];
+    }
+    return NULL;
+}
+
+bool Text_prepare(TTF_Font* font, SDL_Renderer* renderer) {
+    if (font == NULL || renderer == NULL) return false;
+    if (findAtlas(font) != NULL) return true;
+
+    for (int i = 0; i < TEXT_MAX_FONTS; i++) {
+        TextAtlas* atlas = &s_atlases[i];
+        if (atlas->texture != NULL) continue;
+
+        memset(atlas, 0, sizeof(*atlas));
+        atlas->font = font;
+        if (buildAtlas(atlas, renderer)) return true;
+
+        fprintf(stderr, "Erreur creation de l'atlas de glyphes : %s\n", SDL_GetError());
+        atlas->font = NULL;
+        return false;
+    }
+
+    fprintf(stderr, "Trop de polices pour les atlas de glyphes (%d max)\n", TEXT_MAX_FONTS);
+    return false;
+}
+
+void Text_shutdown(void) {
+    for (int i = 0; i < TEXT_MAX_FONTS; i++) {
+        renderDestroyTexture(s_atlases[i].texture);
+        s_atlases[i].texture = NULL;
+        s_atlases[i].font = NULL;
+    }
+}
+
+void Text_size(TTF_Font* font, const char* text, int* width, int* height) {
+    if (width) *width = 0;
+    if (height) *height = 0;
+
+    const TextAtlas* atlas = findAtlas(font);
+    if (atlas == NULL || text == NULL) {
+        if (font != NULL && text != NULL) TTF_SizeText(font, text, width, height);
+        return;
+    }
+
+    int lineWidth = 0;
+    int maxWidth = 0;
+    int lines = 1;
+    int previous = 0;
+
+    while (*text != '\0') {
+        const int codepoint = nextCodepoint(&text);
+        if (codepoint == '\n') {
+            lineWidth = 0;
+            previous = 0;
+            lines++;
+            continue;
+        }
+
+        lineWidth += kerningBetween(atlas, previous, codepoint) + atlas->glyphs[glyphIndex(codepoint)].advance;
+        if (lineWidth > maxWidth) maxWidth = lineWidth;
+        previous = codepoint;
+    }
+
+    if (width) *width = maxWidth;
+    if (height) *height = atlas->height + (lines - 1) * atlas->lineSkip;
+}
+
+static void flushQuads(SDL_Renderer* renderer, const TextAtlas* atlas, int quadCount, long pixels) {
+    if (quadCount == 0) return;
+    renderGeometry(renderer, atlas->texture, s_vertices, quadCount * 4, s_indices, quadCount * 6, pixels);
+}
+
+void Text_draw(SDL_Renderer* renderer, TTF_Font* font, int x, int y, const char* text, SDL_Color color) {
+    if (renderer == NULL || font == NULL || text == NULL) return;
+    if (!Text_prepare(font, renderer)) return;
+    const TextAtlas* atlas = findAtlas(font);
+
+    if (!s_indicesReady) {
+        static const int QUAD_INDICES[6] = {0, 1, 2, 2, 1, 3};
+        for (int quad = 0; quad < TEXT_MAX_QUADS; quad++) {
+            for (int i = 0; i < 6; i++) {
+                s_indices[quad * 6 + i] = quad * 4 + QUAD_INDICES[i];
+            }
+        }
+        s_indicesReady = true;
+    }
+
+    const float texelU = 1.0f / (float)atlas->atlasSize[0];
+    const float texelV = 1.0f / (float)atlas->atlasSize[1];
+    int penX = x;
+    int penY = y;
+    int previous = 0;
+    int quadCount = 0;
+    long pixels = 0;
+
+    while (*text != '\0') {
+        const int codepoint = nextCodepoint(&text);
+        if (codepoint == '\n') {
+            penX = x;
+            penY += atlas->lineSkip;
+            previous = 0;
+            continue;
+        }
+
+        const TextGlyph* glyph = &atlas->glyphs[glyphIndex(codepoint)];
+        penX += kerningBetween(atlas, previous, codepoint);
+        previous = codepoint;
+
+        if (glyph->source.w > 0 && glyph->source.h > 0) {
+            if (quadCount == TEXT_MAX_QUADS) {
+                flushQuads(renderer, atlas, quadCount, pixels);
+                quadCount = 0;
+                pixels = 0;
+            }
+
+            const float left = (float)(penX + glyph->offsetX);
+            const float top = (float)penY;
+            const float right = left + (float)glyph->source.w;
+            const float bottom = top + (float)glyph->source.h;
+            const float u0 = glyph->source.x * texelU;
+            const float v0 = glyph->source.y * texelV;
+            const float u1 = (glyph->source.x + glyph->source.w) * texelU;
+            const float v1 = (glyph->source.y + glyph->source.h) * texelV;
+
+            SDL_Vertex* vertices = &s_vertices[quadCount * 4];
+            vertices[0] = (SDL_Vertex){{left, top}, color, {u0, v0}};
+            vertices[1] = (SDL_Vertex){{right, top}, color, {u1, v0}};
+            vertices[2] = (SDL_Vertex){{left, bottom}, color, {u0, v1}};
+            vertices[3] = (SDL_Vertex){{right, bottom}, color, {u1, v1}};
+            quadCount++;
+            pixels += (long)glyph->source.w * glyph->source.h;
+        }
+
+        penX += glyph->advance;
+    }
+
+    flushQuads(renderer, atlas, quadCount, pixels);
+}
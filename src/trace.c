@@ -0,0 +1,221 @@
+#include "trace.h"
+#include "utils.h"
+
+#include <pthread.h>
+#include <stdatomic.h>
+
+typedef struct {
+    const char* name;
+    const char* category;
+    uint64_t    timestamp;
+    int         threadId;
+    char        phase;
+    char        detail[TRACE_DETAIL_SIZE];
+} TraceEvent;
+
+typedef struct TraceChunk {
+    struct TraceChunk* next;
+    int                count;
+    TraceEvent         events[TRACE_CHUNK_EVENTS];
+} TraceChunk;
+
+static atomic_bool     g_enabled = false;
+static atomic_int      g_nextThreadId = 1;
+static _Thread_local int t_threadId = 0;
+
+static pthread_mutex_t g_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t  g_ready = PTHREAD_COND_INITIALIZER;
+static pthread_t       g_writer;
+
+static FILE*       g_file = NULL;
+static uint64_t    g_origin = 0;
+static TraceChunk* g_current = NULL;
+static TraceChunk* g_pendingHead = NULL;
+static TraceChunk* g_pendingTail = NULL;
+static bool        g_stopping = false;
+static bool        g_firstEvent = true;
+static long        g_droppedEvents = 0;
+
+static int currentThreadId(void) {
+    if (t_threadId == 0) {
+        t_threadId = atomic_fetch_add(&g_nextThreadId, 1);
+    }
+    return t_threadId;
+}
+
+static void writeEscaped(FILE* file, const char* text) {
+    for (const char* c = text; *c != '\0'; c++) {
+        if (*c == '"' || *c == '\\') {
+            fputc('\\', file);
+            fputc(*c, file);
+        } else if ((unsigned char)*c < 0x20) {
+            fprintf(file, "\\u%04x", (unsigned char)*c);
+        } else {
+            fputc(*c, file);
+        }
+    }
+}
+
+static void writeEvent(FILE* file, const TraceEvent* event) {
+    fputs(g_firstEvent ? "\n" : ",\n", file);
+    g_firstEvent = false;
+
+    fputs("{\"name\":\"", file);
+    writeEscaped(file, event->name);
+    fputs("\",\"cat\":\"", file);
+    writeEscaped(file, event->category);
+    fprintf(file, "\",\"ph\":\"%c\",\"ts\":%.3f,\"pid\":1,\"tid\":%d",
+            event->phase, (double)event->timestamp / 1000.0, event->threadId);
+
+    if (event->phase == 'i') {
+        fputs(",\"s\":\"g\"", file);
+    }
+    if (event->detail[0] != '\0') {
+        fputs(",\"args\":{\"detail\":\"", file);
+        writeEscaped(file, event->detail);
+        fputs("\"}", file);
+    }
+    fputc('}', file);
+}
+
+static void queueChunk(TraceChunk* chunk) {
+    chunk->next = NULL;
+    if (g_pendingTail) {
+        g_pendingTail->next = chunk;
+    } else {
+        g_pendingHead = chunk;
+    }
+    g_pendingTail = chunk;
+    pthread_cond_signal(&g_ready);
+}
+
+static void* writerMain(void* unused) {
+    (void)unused;
+
+    pthread_mutex_lock(&g_lock);
+    for (;;) {
+        while (!g_pendingHead && !g_stopping) {
+            pthread_cond_wait(&g_ready, &g_lock);
+        }
+        if (!g_pendingHead) break;
+
+        TraceChunk* chunk = g_pendingHead;
+        g_pendingHead = chunk->next;
+        if (!g_pendingHead) g_pendingTail = NULL;
+        pthread_mutex_unlock(&g_lock);
+
+        for (int i = 0; i < chunk->count; i++) {
+            writeEvent(g_file, &chunk->events[i]);
+        }
+        free(chunk);
+
+        pthread_mutex_lock(&g_lock);
+    }
+    pthread_mutex_unlock(&g_lock);
+    return NULL;
+}
+
+static void emit(char phase, const char* name, const char* category, const char* detail) {
+    if (!atomic_load_explicit(&g_enabled, memory_order_relaxed)) return;
+
+    const uint64_t now = timeNowNs();
+    const int threadId = currentThreadId();
+
+    pthread_mutex_lock(&g_lock);
+    if (g_current && g_current->count == TRACE_CHUNK_EVENTS) {
+        queueChunk(g_current);
+        g_current = NULL;
+    }
+    if (!g_current) {
+        g_current = malloc(sizeof(TraceChunk));
+        if (g_current) g_current->count = 0;
+    }
+
+    if (g_current) {
+        TraceEvent* event = &g_current->events[g_current->count++];
+        event->name = name;
+        event->category = category;
+        event->timestamp = now - g_origin;
+        event->threadId = threadId;
+        event->phase = phase;
+        event->detail[0] = '\0';
+        if (detail) {
+            strncpy(event->detail, detail, TRACE_DETAIL_SIZE - 1);
+            event->detail[TRACE_DETAIL_SIZE - 1] = '\0';
+        }
+    } else {
+        g_droppedEvents++;
+    }
+    pthread_mutex_unlock(&g_lock);
+}
+
+bool Trace_start(const char* path) {
+    if (atomic_load(&g_enabled)) return true;
+
+    g_file = fopen(path, "w");
+    if (!g_file) {
+        fprintf(stderr, "Trace : impossible d'ecrire %s\n", path);
+        return false;
+    }
+
+    g_origin = timeNowNs();
+    g_stopping = false;
+    g_firstEvent = true;
+    g_droppedEvents = 0;
+    fputs("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[", g_file);
+
+    if (pthread_create(&g_writer, NULL, writerMain, NULL) != 0) {
+        fprintf(stderr, "Trace : impossible de demarrer le thread d'ecriture\n");
+        fclose(g_file);
+        g_file = NULL;
+        return false;
+    }
+
+    atomic_store(&g_enabled, true);
+    Trace_instant("trace_start", "trace", path);
+    return true;
+}
+
+void Trace_stop(void) {
+    if (!atomic_load(&g_enabled)) return;
+    atomic_store(&g_enabled, false);
+
+    pthread_mutex_lock(&g_lock);
+    if (g_current) {
+        queueChunk(g_current);
+        g_current = NULL;
+    }
+    g_stopping = true;
+    pthread_cond_signal(&g_ready);
+    pthread_mutex_unlock(&g_lock);
+
+    pthread_join(g_writer, NULL);
+
+    fputs("\n]}\n", g_file);
+    fclose(g_file);
+    g_file = NULL;
+
+    if (g_droppedEvents > 0) {
+        fprintf(stderr, "Trace : %ld evenements perdus (memoire insuffisante)\n", g_droppedEvents);
+    }
+}
+
+bool Trace_isEnabled(void) {
+    return atomic_load_explicit(&g_enabled, memory_order_relaxed);
+}
+
+void Trace_begin(const char* name, const char* category) {
+    emit('B', name, category, NULL);
+}
+
+void Trace_beginDetail(const char* name, const char* category, const char* detail) {
+    emit('B', name, category, detail);
+}
+
+void Trace_end(const char* name, const char* category) {
+    emit('E', name, category, NULL);
+}
+
+void Trace_instant(const char* name, const char* category, const char* detail) {
+    emit('i', name, category, detail);
+}
@@ -1,5 +1,13 @@
 #include "utils.h"
 
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+static uint32_t g_randomState = 1;
+
 void worldToScreen(const int worldPos[2], int screenPos[2], const int roomPos[2]) {
     screenPos[0] = (worldPos[0] - roomPos[0] * GRID_ROOM_WIDTH) * GRID_CELL_SIZE;
     screenPos[1] = (worldPos[1] - roomPos[1] * GRID_ROOM_HEIGHT) * GRID_CELL_SIZE;
@@ -24,3 +32,34 @@ void copyPosition(const int src[2], int dest[2]) {
     dest[0] = src[0];
     dest[1] = src[1];
 }
+
+uint64_t timeNowNs(void) {
+#ifdef _WIN32
+    LARGE_INTEGER frequency;
+    LARGE_INTEGER counter;
+    QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&counter);
+    return (uint64_t)((double)counter.QuadPart * 1e9 / (double)frequency.QuadPart);
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+void randomSeed(uint32_t seed) {
+    g_randomState = seed != 0 ? seed : 0x9E3779B9u;
+}
+
+int randomInt(int bound) {
+    uint32_t x = g_randomState;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    g_randomState = x;
+    return bound > 0 ? (int)(x % (uint32_t)bound) : 0;
+}
+
+uint32_t randomState(void) {
+    return g_randomState;
+}
@@ -0,0 +1,31 @@
+#include "visibility.h"
+
+void ViewRect_fromCamera(const Camera* view, ViewRect* rect) {
+    const float gameHeight = (float)(WINDOW_HEIGHT - WINDOW_TEXTAREA_HEIGHT);
+
+    rect->left = view->x / GRID_CELL_SIZE - VISIBILITY_MARGIN_CELLS;
+    rect->top = view->y / GRID_CELL_SIZE - VISIBILITY_MARGIN_CELLS;
+    rect->right = (view->x + WINDOW_WIDTH) / GRID_CELL_SIZE + VISIBILITY_MARGIN_CELLS;
+    rect->bottom = (view->y + gameHeight) / GRID_CELL_SIZE + VISIBILITY_MARGIN_CELLS;
+}
+
+bool ViewRect_contains(const ViewRect* rect, float cellX, float cellY) {
+    return cellX + 1.0f > rect->left && cellX < rect->right &&
+           cellY + 1.0f > rect->top && cellY < rect->bottom;
+}
+
+int Visibility_collectEnemies(const ViewRect* rect, const Enemy* enemies, int count, float alpha, int* visible) {
+    int visibleCount = 0;
+
+    for (int i = 0; i < count; i++) {
+        if (!enemies[i].isActive) continue;
+
+        float renderPos[2];
+        Character_getRenderPos(&enemies[i].base, alpha, renderPos);
+        if (ViewRect_contains(rect, renderPos[0], renderPos[1])) {
+            visible[visibleCount++] = i;
+        }
+    }
+
+    return visibleCount;
+}
@@ -0,0 +1,397 @@
+#include "world.h"
+#include "utils.h"
+#include "profiler.h"
+
+#define ENEMIES_PER_ZONE    5
+#define ENEMY_SPAWN_MIN_DISTANCE    4
+#define ENEMY_SPAWN_MAX_DISTANCE    10
+#define ENEMY_DESPAWN_DISTANCE      20
+
+#define HASH_FNV_OFFSET     2166136261u
+#define HASH_FNV_PRIME      16777619u
+
+static float absf(float value) {
+    return value < 0.0f ? -value : value;
+}
+
+static uint32_t hashInt(uint32_t hash, int32_t value) {
+    const uint32_t bits = (uint32_t)value;
+    for (int i = 0; i < 4; i++) {
+        hash ^= (bits >> (i * 8)) & 0xFFu;
+        hash *= HASH_FNV_PRIME;
+    }
+    return hash;
+}
+
+static uint32_t hashFloat(uint32_t hash, float value) {
+    int32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return hashInt(hash, bits);
+}
+
+static uint32_t hashAnimation(uint32_t hash, const AnimationState* anim) {
+    hash = hashInt(hash, (int32_t)anim->direction);
+    hash = hashInt(hash, (int32_t)anim->state);
+    hash = hashInt(hash, anim->currentFrame);
+    hash = hashInt(hash, anim->frameCounter);
+    return hash;
+}
+
+void World_randomPositionNearPlayer(const Map* map, const int playerPos[2], int outPos[2]) {
+    for (int attempts = 0; attempts < 100; attempts++) {
+        int offsetX = randomInt(2 * ENEMY_SPAWN_MAX_DISTANCE + 1) - ENEMY_SPAWN_MAX_DISTANCE;
+        int offsetY = randomInt(2 * ENEMY_SPAWN_MAX_DISTANCE + 1) - ENEMY_SPAWN_MAX_DISTANCE;
+
+        outPos[0] = playerPos[0] + offsetX;
+        outPos[1] = playerPos[1] + offsetY;
+
+        if (outPos[0] < 1 || outPos[0] >= GRID_WORLD_WIDTH - 1 ||
+            outPos[1] < 1 || outPos[1] >= GRID_WORLD_HEIGHT - 1) {
+            continue;
+        }
+
+        int dx = outPos[0] - playerPos[0];
+        int dy = outPos[1] - playerPos[1];
+        int distance = (dx > 0 ? dx : -dx) + (dy > 0 ? dy : -dy);
+
+        if (!Map_isBlocking(map, outPos) && distance >= ENEMY_SPAWN_MIN_DISTANCE) {
+            return;
+        }
+    }
+
+    outPos[0] = playerPos[0] + ENEMY_SPAWN_MIN_DISTANCE;
+    outPos[1] = playerPos[1];
+}
+
+static void spawnEnemiesNearPlayer(World* world) {
+    world->enemyCount = 0;
+
+    int playerPos[2];
+    Character_getGridPos(&world->player.base, playerPos);
+
+    for (int i = 0; i < ENEMIES_PER_ZONE && world->enemyCount < GAME_MAX_ENEMIES; i++) {
+        int spawnPos[2];
+        World_randomPositionNearPlayer(&world->map, playerPos, spawnPos);
+
+        EnemyType type;
+        EnemyAI ai;
+
+        switch (i % 3) {
+            case 0:
+                type = ENEMY_TYPE_BASIC;
+                ai = ENEMY_AI_RANDOM;
+                break;
+            case 1:
+                type = ENEMY_TYPE_FAST;
+                ai = ENEMY_AI_CHASE;
+                break;
+            case 2:
+                type = ENEMY_TYPE_TANK;
+                ai = ENEMY_AI_CHASE;
+                break;
+            default:
+                type = ENEMY_TYPE_BASIC;
+                ai = ENEMY_AI_RANDOM;
+                break;
+        }
+
+        Enemy_init(&world->enemies[world->enemyCount], type, ai, &world->map, spawnPos);
+        world->enemyCount++;
+    }
+}
+
+static void spawnSingleEnemy(World* world) {
+    int slot = -1;
+
+    for (int i = 0; i < world->enemyCount; i++) {
+        if (!world->enemies[i].isActive) {
+            slot = i;
+            break;
+        }
+    }
+
+    if (slot == -1) {
+        if (world->enemyCount >= GAME_MAX_ENEMIES) return;
+        slot = world->enemyCount;
+        world->enemyCount++;
+    }
+
+    int spawnPos[2];
+    int playerPos[2];
+    Character_getGridPos(&world->player.base, playerPos);
+    World_randomPositionNearPlayer(&world->map, playerPos, spawnPos);
+
+    EnemyType type;
+    EnemyAI ai;
+    int r = randomInt(3);
+
+    switch (r) {
+        case 0:
+            type = ENEMY_TYPE_BASIC;
+            ai = ENEMY_AI_RANDOM;
+            break;
+        case 1:
+            type = ENEMY_TYPE_FAST;
+            ai = ENEMY_AI_CHASE;
+            break;
+        default:
+            type = ENEMY_TYPE_TANK;
+            ai = ENEMY_AI_CHASE;
+            break;
+    }
+
+    Enemy_init(&world->enemies[slot], type, ai, &world->map, spawnPos);
+}
+
+static void despawnDistantEnemies(World* world) {
+    int playerPos[2];
+    Character_getGridPos(&world->player.base, playerPos);
+
+    for (int i = 0; i < world->enemyCount; i++) {
+        if (!world->enemies[i].isActive) continue;
+
+        int enemyPos[2];
+        Character_getGridPos(&world->enemies[i].base, enemyPos);
+
+        int dx = enemyPos[0] - playerPos[0];
+        int dy = enemyPos[1] - playerPos[1];
+        int distance = (dx > 0 ? dx : -dx) + (dy > 0 ? dy : -dy);
+
+        if (distance > ENEMY_DESPAWN_DISTANCE) {
+            world->enemies[i].isActive = false;
+        }
+    }
+}
+
+static void resetPlayerStats(World* world) {
+    world->stats.score = GAME_INITIAL_SCORE;
+    world->stats.kills = 0;
+    world->stats.playtime = 0;
+    world->stats.moves = 0;
+}
+
+void World_beginTick(World* world) {
+    Character_savePosition(&world->player.base);
+    Camera_savePosition(&world->map.camera);
+
+    for (int i = 0; i < world->enemyCount; i++) {
+        Character_savePosition(&world->enemies[i].base);
+    }
+}
+
+static void checkEnemyCollisions(World* world) {
+    int playerPos[2];
+    Character_getGridPos(&world->player.base, playerPos);
+
+    for (int i = 0; i < world->enemyCount; i++) {
+        if (!world->enemies[i].isActive) continue;
+
+        int livesBefore = world->player.base.lives;
+        if (Enemy_collidesWith(&world->enemies[i], playerPos)) {
+            Link_takeDamage(&world->player, 1);
+            if (world->player.base.lives < livesBefore) {
+                world->events |= WORLD_EVENT_PLAYER_HIT;
+            }
+        }
+    }
+}
+
+static void handleAttack(World* world) {
+    if (!Link_isAttacking(&world->player)) return;
+    if (world->player.attackCooldown < LINK_ATTACK_COOLDOWN - LINK_ATTACK_ACTIVE_TIME) return;
+
+    int attackZone[LINK_ATTACK_ZONE_SIZE][2];
+    Link_getAttackZone(&world->player, attackZone);
+
+    for (int i = 0; i < world->enemyCount; i++) {
+        if (!world->enemies[i].isActive) continue;
+        if (world->enemies[i].hitTimer > 0) continue;
+
+        for (int z = 0; z < LINK_ATTACK_ZONE_SIZE; z++) {
+            if (Enemy_collidesWith(&world->enemies[i], attackZone[z])) {
+                if (Enemy_takeDamage(&world->enemies[i], 1)) {
+                    world->stats.kills++;
+                    world->stats.score += ENEMY_KILL_SCORE;
+                    world->events |= WORLD_EVENT_ENEMY_KILLED;
+                }
+                break;
+            }
+        }
+    }
+}
+
+void World_init(World* world, unsigned seed) {
+    randomSeed(seed);
+
+    resetPlayerStats(world);
+    world->events = 0;
+    world->playerMoving = false;
+
+    Map_init(&world->map);
+
+    const int initialRoom[2] = GAME_INITIAL_ROOM;
+    world->map.currentRoom[0] = initialRoom[0];
+    world->map.currentRoom[1] = initialRoom[1];
+
+    Link_init(&world->player, &world->map);
+
+    int centerPos[2];
+    Room_getCenter(&world->map.rooms[initialRoom[1]][initialRoom[0]], centerPos);
+    world->player.base.posX = (float)centerPos[0];
+    world->player.base.posY = (float)centerPos[1];
+    Character_savePosition(&world->player.base);
+
+    Camera_followF(&world->map.camera, world->player.base.posX, world->player.base.posY);
+    world->map.camera.x = world->map.camera.targetX;
+    world->map.camera.y = world->map.camera.targetY;
+    Camera_savePosition(&world->map.camera);
+
+    spawnEnemiesNearPlayer(world);
+}
+
+void World_applyInput(World* world, const InputState* input) {
+    int gridPos[2];
+    Character_getGridPos(&world->player.base, gridPos);
+    int oldPos[2] = {gridPos[0], gridPos[1]};
+    float oldX = world->player.base.posX;
+    float oldY = world->player.base.posY;
+
+    float deltaX = 0.0f;
+    float deltaY = 0.0f;
+
+    if (input->moveUp) deltaY -= MOVEMENT_SPEED;
+    if (input->moveDown) deltaY += MOVEMENT_SPEED;
+    if (input->moveLeft) deltaX -= MOVEMENT_SPEED;
+    if (input->moveRight) deltaX += MOVEMENT_SPEED;
+
+    if (deltaX != 0.0f && deltaY != 0.0f) {
+        const float diagonalFactor = 0.70710678f;
+        deltaX *= diagonalFactor;
+        deltaY *= diagonalFactor;
+    }
+
+    if (deltaX != 0.0f || deltaY != 0.0f) {
+        Link_moveSmooth(&world->player, deltaX, deltaY);
+    } else if (!Link_isAttacking(&world->player)) {
+        Animation_stop(&world->player.animation);
+    }
+
+    world->playerMoving = absf(world->player.base.posX - oldX) > 0.0001f ||
+                          absf(world->player.base.posY - oldY) > 0.0001f;
+
+    if (input->attack) {
+        const bool wasAttacking = Link_isAttacking(&world->player);
+        Link_attack(&world->player);
+        if (!wasAttacking && Link_isAttacking(&world->player)) {
+            world->events |= WORLD_EVENT_ATTACK;
+        }
+    }
+
+    Character_getGridPos(&world->player.base, gridPos);
+    if (oldPos[0] != gridPos[0] || oldPos[1] != gridPos[1]) {
+        world->stats.moves++;
+    }
+}
+
+WorldOutcome World_update(World* world) {
+    Link_update(&world->player);
+
+    Profiler_begin(PROFILE_ZONE_COLLISION);
+    handleAttack(world);
+    Profiler_end(PROFILE_ZONE_COLLISION);
+
+    int playerPos[2];
+    Character_getGridPos(&world->player.base, playerPos);
+
+    Camera_followF(&world->map.camera, world->player.base.posX, world->player.base.posY);
+    Room_handleTransition(&world->map, playerPos);
+
+    Profiler_begin(PROFILE_ZONE_SPAWN);
+    despawnDistantEnemies(world);
+
+    int activeCount = World_countActiveEnemies(world);
+    if (activeCount < ENEMIES_PER_ZONE) {
+        int toSpawn = ENEMIES_PER_ZONE - activeCount;
+        for (int i = 0; i < toSpawn; i++) {
+            spawnSingleEnemy(world);
+        }
+    }
+    Profiler_end(PROFILE_ZONE_SPAWN);
+
+    Profiler_begin(PROFILE_ZONE_AI);
+    for (int i = 0; i < world->enemyCount; i++) {
+        if (world->enemies[i].isActive) {
+            Enemy_update(&world->enemies[i], playerPos, world->enemies, world->enemyCount, i);
+        }
+    }
+    Profiler_end(PROFILE_ZONE_AI);
+
+    Profiler_begin(PROFILE_ZONE_COLLISION);
+    checkEnemyCollisions(world);
+    Profiler_end(PROFILE_ZONE_COLLISION);
+    world->stats.playtime++;
+
+    if (world->player.base.lives <= 0) {
+        return WORLD_OUTCOME_DEFEAT;
+    }
+    if (world->stats.kills >= GAME_WIN_KILLS) {
+        return WORLD_OUTCOME_VICTORY;
+    }
+    return WORLD_OUTCOME_RUNNING;
+}
+
+unsigned World_takeEvents(World* world) {
+    const unsigned events = world->events;
+    world->events = 0;
+    return events;
+}
+
+int World_countActiveEnemies(const World* world) {
+    int count = 0;
+    for (int i = 0; i < world->enemyCount; i++) {
+        if (world->enemies[i].isActive) {
+            count++;
+        }
+    }
+    return count;
+}
+
+uint32_t World_hash(const World* world) {
+    uint32_t hash = HASH_FNV_OFFSET;
+
+    hash = hashInt(hash, world->stats.score);
+    hash = hashInt(hash, world->stats.kills);
+    hash = hashInt(hash, world->stats.playtime);
+    hash = hashInt(hash, world->stats.moves);
+    hash = hashInt(hash, (int32_t)randomState());
+    hash = hashInt(hash, world->map.currentRoom[0]);
+    hash = hashInt(hash, world->map.currentRoom[1]);
+
+    const Link* player = &world->player;
+    hash = hashFloat(hash, player->base.posX);
+    hash = hashFloat(hash, player->base.posY);
+    hash = hashInt(hash, player->base.lives);
+    hash = hashInt(hash, (int32_t)player->direction);
+    hash = hashInt(hash, player->isAttacking);
+    hash = hashInt(hash, player->attackCooldown);
+    hash = hashInt(hash, player->invincibilityTimer);
+    hash = hashAnimation(hash, &player->animation);
+
+    hash = hashInt(hash, world->enemyCount);
+    for (int i = 0; i < world->enemyCount; i++) {
+        const Enemy* enemy = &world->enemies[i];
+        hash = hashInt(hash, enemy->isActive);
+        if (!enemy->isActive) continue;
+
+        hash = hashFloat(hash, enemy->base.posX);
+        hash = hashFloat(hash, enemy->base.posY);
+        hash = hashInt(hash, enemy->base.lives);
+        hash = hashInt(hash, (int32_t)enemy->enemyType);
+        hash = hashInt(hash, (int32_t)enemy->ai);
+        hash = hashInt(hash, enemy->moveTimer);
+        hash = hashInt(hash, enemy->hitTimer);
+        hash = hashAnimation(hash, &enemy->animation);
+    }
+
+    return hash;
+}
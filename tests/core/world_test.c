@@ -0,0 +1,60 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "world.h"
+
+#define TEST_SEED 1234u
+
+static int g_failures = 0;
+
+static void expect(bool condition, const char* name) {
+    if (condition) return;
+    fprintf(stderr, "ECHEC : %s\n", name);
+    g_failures++;
+}
+
+static void testHeldDirectionInterpolates(void) {
+    World world;
+    World_init(&world, TEST_SEED);
+
+    const InputState input = {.moveRight = true};
+    World_beginTick(&world);
+    World_applyInput(&world, &input);
+    World_update(&world);
+
+    const Character* player = &world.player.base;
+    expect(player->prevX != player->posX, "une direction maintenue doit separer prevX et posX");
+    expect(player->prevY == player->posY, "un deplacement horizontal ne doit pas toucher prevY");
+
+    float renderPos[2];
+    Character_getRenderPos(player, 0.5f, renderPos);
+    expect(renderPos[0] > player->prevX && renderPos[0] < player->posX,
+           "la position interpolee doit se trouver entre prevX et posX");
+}
+
+static void testIdleTickIsStill(void) {
+    World world;
+    World_init(&world, TEST_SEED);
+
+    const InputState input = {0};
+    World_beginTick(&world);
+    World_applyInput(&world, &input);
+    World_update(&world);
+
+    const Character* player = &world.player.base;
+    expect(player->prevX == player->posX && player->prevY == player->posY,
+           "un tick sans entree doit garder le joueur immobile");
+}
+
+int main(void) {
+    testHeldDirectionInterpolates();
+    testIdleTickIsStill();
+
+    if (g_failures > 0) {
+        fprintf(stderr, "%d test(s) en echec\n", g_failures);
+        return EXIT_FAILURE;
+    }
+
+    printf("world_test : OK\n");
+    return EXIT_SUCCESS;
+}
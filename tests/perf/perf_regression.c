@@ -0,0 +1,334 @@
+#include "world.h"
+#include "replay.h"
+#include "profiler.h"
+#include "flightrecorder.h"
+#include "assets.h"
+#include "utils.h"
+
+#define DEFAULT_REPEAT      10
+#define DEFAULT_MARGIN      0.25
+#define NS_PER_MS           1e6
+#define CALIBRATION_KEY     "CALIBRATION_NS"
+#define CALIBRATION_ROUNDS  15
+#define CALIBRATION_CELLS   4096
+#define CALIBRATION_STEPS   200000
+
+typedef enum {
+    METRIC_TICK_MEAN,
+    METRIC_TICK_P99,
+    METRIC_AI_MEAN,
+    METRIC_COLLISION_MEAN,
+    METRIC_SPAWN_MEAN,
+    METRIC_ALLOCS_PER_TICK,
+    METRIC_COUNT
+} Metric;
+
+static const char* METRIC_KEYS[METRIC_COUNT] = {
+    [METRIC_TICK_MEAN]       = "TICK_MEAN_NS",
+    [METRIC_TICK_P99]        = "TICK_P99_NS",
+    [METRIC_AI_MEAN]         = "AI_MEAN_NS",
+    [METRIC_COLLISION_MEAN]  = "COLLISION_MEAN_NS",
+    [METRIC_SPAWN_MEAN]      = "SPAWN_MEAN_NS",
+    [METRIC_ALLOCS_PER_TICK] = "ALLOCS_PER_TICK"
+};
+
+typedef struct {
+    const char* replayPath;
+    const char* budgetsPath;
+    const char* writePath;
+    double      margin;
+    int         repeat;
+} PerfOptions;
+
+static long g_allocations = 0;
+static bool g_countAllocations = false;
+
+#if defined(__GLIBC__)
+extern void* __libc_malloc(size_t size);
+extern void* __libc_calloc(size_t count, size_t size);
+extern void* __libc_realloc(void* ptr, size_t size);
+
+void* malloc(size_t size) {
+    if (g_countAllocations) g_allocations++;
+    return __libc_malloc(size);
+}
+
+void* calloc(size_t count, size_t size) {
+    if (g_countAllocations) g_allocations++;
+    return __libc_calloc(count, size);
+}
+
+void* realloc(void* ptr, size_t size) {
+    if (g_countAllocations) g_allocations++;
+    return __libc_realloc(ptr, size);
+}
+
+#define ALLOCATION_TRACKING true
+#else
+#define ALLOCATION_TRACKING false
+#endif
+
+static volatile uint32_t g_calibrationSink = 0;
+
+static double calibrate(void) {
+    static uint32_t cells[CALIBRATION_CELLS];
+    double best = -1.0;
+
+    for (int round = 0; round < CALIBRATION_ROUNDS; round++) {
+        for (int i = 0; i < CALIBRATION_CELLS; i++) {
+            cells[i] = (uint32_t)i * 2654435761u;
+        }
+
+        uint32_t state = 0x9E3779B9u;
+        const uint64_t start = timeNowNs();
+        for (int step = 0; step < CALIBRATION_STEPS; step++) {
+            state ^= state << 13;
+            state ^= state >> 17;
+            state ^= state << 5;
+
+            const uint32_t index = state % CALIBRATION_CELLS;
+            const uint32_t neighbour = cells[(index + 1) % CALIBRATION_CELLS];
+            cells[index] = cells[index] * 31u + (neighbour >> 3);
+            if (cells[index] & 1u) cells[index] ^= state;
+        }
+        const double elapsed = (double)(timeNowNs() - start);
+        g_calibrationSink ^= cells[state % CALIBRATION_CELLS];
+
+        if (best < 0.0 || elapsed < best) best = elapsed;
+    }
+
+    return best / CALIBRATION_STEPS;
+}
+
+static int compareDoubles(const void* a, const void* b) {
+    const double da = *(const double*)a;
+    const double db = *(const double*)b;
+    return (da > db) - (da < db);
+}
+
+static bool runSession(Replay* replay, double* tickNs, double metrics[METRIC_COUNT]) {
+    static World world;
+    World_init(&world, replay->seed);
+    replay->cursor = 0;
+
+    double aiNs = 0.0;
+    double collisionNs = 0.0;
+    double spawnNs = 0.0;
+
+    InputState input;
+    uint32_t expected;
+
+    g_allocations = 0;
+    g_countAllocations = true;
+
+    while (Replay_next(replay, &input, &expected)) {
+        Profiler_beginFrame();
+        const uint64_t start = timeNowNs();
+
+        World_beginTick(&world);
+        World_applyInput(&world, &input);
+        World_update(&world);
+        World_takeEvents(&world);
+
+        tickNs[replay->cursor - 1] = (double)(timeNowNs() - start);
+        Profiler_endFrame();
+
+        aiNs += Profiler_lastZoneMs(PROFILE_ZONE_AI) * NS_PER_MS;
+        collisionNs += Profiler_lastZoneMs(PROFILE_ZONE_COLLISION) * NS_PER_MS;
+        spawnNs += Profiler_lastZoneMs(PROFILE_ZONE_SPAWN) * NS_PER_MS;
+
+        if (World_hash(&world) != expected) {
+            g_countAllocations = false;
+            fprintf(stderr, "Replay divergent au tick %d : la session de reference doit etre reenregistree\n",
+                    replay->cursor - 1);
+            return false;
+        }
+    }
+
+    g_countAllocations = false;
+
+    const int ticks = replay->count;
+    double total = 0.0;
+    for (int i = 0; i < ticks; i++) {
+        total += tickNs[i];
+    }
+    qsort(tickNs, (size_t)ticks, sizeof(double), compareDoubles);
+
+    int p99Index = (ticks * 99 + 99) / 100 - 1;
+    if (p99Index < 0) p99Index = 0;
+
+    metrics[METRIC_TICK_MEAN] = total / ticks;
+    metrics[METRIC_TICK_P99] = tickNs[p99Index];
+    metrics[METRIC_AI_MEAN] = aiNs / ticks;
+    metrics[METRIC_COLLISION_MEAN] = collisionNs / ticks;
+    metrics[METRIC_SPAWN_MEAN] = spawnNs / ticks;
+    metrics[METRIC_ALLOCS_PER_TICK] = (double)g_allocations / ticks;
+    return true;
+}
+
+static bool loadBudgets(const char* path, double budgets[METRIC_COUNT], bool present[METRIC_COUNT],
+                        double* calibrationNs) {
+    FILE* file = fopen(path, "r");
+    if (!file) {
+        fprintf(stderr, "Budgets introuvables : %s\n", path);
+        return false;
+    }
+
+    char line[256];
+    while (fgets(line, sizeof(line), file)) {
+        if (line[0] == '#' || line[0] == '\n') continue;
+
+        char* separator = strchr(line, '=');
+        if (!separator) continue;
+        *separator = '\0';
+
+        if (strcmp(line, CALIBRATION_KEY) == 0) {
+            *calibrationNs = strtod(separator + 1, NULL);
+            continue;
+        }
+        for (int m = 0; m < METRIC_COUNT; m++) {
+            if (strcmp(line, METRIC_KEYS[m]) == 0) {
+                budgets[m] = strtod(separator + 1, NULL);
+                present[m] = true;
+            }
+        }
+    }
+
+    fclose(file);
+    return true;
+}
+
+static bool writeBudgets(const char* path, const char* replayPath, const double metrics[METRIC_COUNT],
+                         double calibrationNs) {
+    FILE* file = fopen(path, "w");
+    if (!file) {
+        fprintf(stderr, "Impossible d'ecrire %s\n", path);
+        return false;
+    }
+
+    fprintf(file, "# Budgets de %s (ns par tick, allocations par tick)\n", replayPath);
+    fprintf(file, "%s=%.3f\n", CALIBRATION_KEY, calibrationNs);
+    for (int m = 0; m < METRIC_COUNT; m++) {
+        fprintf(file, "%s=%.2f\n", METRIC_KEYS[m], metrics[m]);
+    }
+
+    fclose(file);
+    return true;
+}
+
+static bool parseOptions(int argc, char* argv[], PerfOptions* options) {
+    options->replayPath = NULL;
+    options->budgetsPath = NULL;
+    options->writePath = NULL;
+    options->margin = DEFAULT_MARGIN;
+    options->repeat = DEFAULT_REPEAT;
+
+    for (int i = 1; i < argc; i++) {
+        const bool hasValue = i + 1 < argc;
+
+        if (strcmp(argv[i], "--replay") == 0 && hasValue) {
+            options->replayPath = argv[++i];
+        } else if (strcmp(argv[i], "--budgets") == 0 && hasValue) {
+            options->budgetsPath = argv[++i];
+        } else if (strcmp(argv[i], "--write-budgets") == 0 && hasValue) {
+            options->writePath = argv[++i];
+        } else if (strcmp(argv[i], "--margin") == 0 && hasValue) {
+            options->margin = strtod(argv[++i], NULL);
+        } else if (strcmp(argv[i], "--repeat") == 0 && hasValue) {
+            options->repeat = (int)strtol(argv[++i], NULL, 10);
+        } else {
+            return false;
+        }
+    }
+
+    return options->replayPath && (options->budgetsPath || options->writePath) &&
+           options->repeat > 0 && options->margin >= 0.0;
+}
+
+int main(int argc, char* argv[]) {
+    PerfOptions options;
+    if (!parseOptions(argc, argv, &options)) {
+        fprintf(stderr, "Usage : %s --replay FICHIER (--budgets FICHIER | --write-budgets FICHIER)\n"
+                        "       [--margin 0.25] [--repeat N]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    if (!assets_initFromExecutable(argv[0])) {
+        fprintf(stderr, "Impossible d'initialiser le resolver d'assets\n");
+        return EXIT_FAILURE;
+    }
+
+    Replay replay = {0};
+    if (!Replay_load(&replay, options.replayPath) || replay.count == 0) {
+        Replay_free(&replay);
+        return EXIT_FAILURE;
+    }
+
+    FlightRecorder_setThreshold(0.0f);
+
+    double* tickNs = malloc((size_t)replay.count * sizeof(double));
+    if (!tickNs) {
+        Replay_free(&replay);
+        return EXIT_FAILURE;
+    }
+
+    double best[METRIC_COUNT];
+    for (int m = 0; m < METRIC_COUNT; m++) {
+        best[m] = -1.0;
+    }
+
+    bool ok = true;
+    for (int r = 0; r < options.repeat && ok; r++) {
+        double metrics[METRIC_COUNT];
+        ok = runSession(&replay, tickNs, metrics);
+
+        for (int m = 0; ok && m < METRIC_COUNT; m++) {
+            if (best[m] < 0.0 || metrics[m] < best[m]) best[m] = metrics[m];
+        }
+    }
+
+    free(tickNs);
+    const int ticks = replay.count;
+    Replay_free(&replay);
+    if (!ok) return EXIT_FAILURE;
+
+    const double calibrationNs = calibrate();
+    printf("session      : %s (%d ticks x %d)\n", options.replayPath, ticks, options.repeat);
+    printf("calibration  : %.3f ns/pas\n", calibrationNs);
+    if (!ALLOCATION_TRACKING) {
+        printf("allocations  : non mesurees sur cette plateforme\n");
+    }
+
+    if (options.writePath) {
+        return writeBudgets(options.writePath, options.replayPath, best, calibrationNs) ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    double budgets[METRIC_COUNT] = {0};
+    bool present[METRIC_COUNT] = {false};
+    double referenceNs = 0.0;
+    if (!loadBudgets(options.budgetsPath, budgets, present, &referenceNs)) {
+        return EXIT_FAILURE;
+    }
+
+    const double speed = referenceNs > 0.0 ? calibrationNs / referenceNs : 1.0;
+    if (referenceNs > 0.0) {
+        printf("machine      : x%.2f par rapport a la reference (%.3f ns/pas)\n", speed, referenceNs);
+    }
+
+    int failures = 0;
+    for (int m = 0; m < METRIC_COUNT; m++) {
+        if (!present[m]) continue;
+        if (m == METRIC_ALLOCS_PER_TICK && !ALLOCATION_TRACKING) continue;
+
+        const bool timed = m != METRIC_ALLOCS_PER_TICK;
+        const double budget = timed ? budgets[m] * speed : budgets[m];
+        const double limit = timed ? budget * (1.0 + options.margin) : budget;
+        const bool over = best[m] > limit;
+        if (over) failures++;
+
+        printf("%-18s : %10.2f  (budget %.2f, limite %.2f) %s\n",
+               METRIC_KEYS[m], best[m], budget, limit, over ? "DEPASSE" : "ok");
+    }
+
+    return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,320 @@
+#include "game.h"
+#include "framebuffer.h"
+#include "utils.h"
+
+#include <SDL2/SDL_image.h>
+
+#define MAX_CHECKPOINTS         32
+#define CHECKPOINT_NAME_SIZE    48
+#define CHECKPOINT_MENU         -1
+#define DEFAULT_TOLERANCE       0.001
+#define DEFAULT_THRESHOLD       8
+#define LOADING_TIMEOUT_MS      10000
+#define PATH_SIZE               512
+
+typedef struct {
+    char name[CHECKPOINT_NAME_SIZE];
+    int  tick;
+    bool pause;
+} Checkpoint;
+
+typedef struct {
+    const char* replayPath;
+    const char* checkpointsPath;
+    const char* goldenDir;
+    const char* outDir;
+    const char* timingsPath;
+    double      tolerance;
+    int         threshold;
+    bool        update;
+} GoldenOptions;
+
+typedef enum {
+    RESULT_MATCH,
+    RESULT_MISMATCH,
+    RESULT_MISSING,
+    RESULT_ERROR
+} CompareResult;
+
+static const char* RESULT_NAMES[] = {
+    [RESULT_MATCH]    = "ok",
+    [RESULT_MISMATCH] = "DIFFERENT",
+    [RESULT_MISSING]  = "reference manquante",
+    [RESULT_ERROR]    = "ERREUR"
+};
+
+static int loadCheckpoints(const char* path, Checkpoint* checkpoints) {
+    FILE* file = fopen(path, "r");
+    if (!file) {
+        fprintf(stderr, "Points de capture introuvables : %s\n", path);
+        return -1;
+    }
+
+    int count = 0;
+    char line[256];
+    while (fgets(line, sizeof(line), file) && count < MAX_CHECKPOINTS) {
+        if (line[0] == '#' || line[0] == '\n') continue;
+
+        char* separator = strchr(line, '=');
+        if (!separator || separator - line >= CHECKPOINT_NAME_SIZE) continue;
+        *separator = '\0';
+
+        Checkpoint* checkpoint = &checkpoints[count];
+        strcpy(checkpoint->name, line);
+
+        const char* value = separator + 1;
+        if (strncmp(value, "menu", 4) == 0) {
+            checkpoint->tick = CHECKPOINT_MENU;
+        } else {
+            char* end = NULL;
+            checkpoint->tick = (int)strtol(value, &end, 10);
+            if (end == value || checkpoint->tick < 0) continue;
+            checkpoint->pause = strstr(end, "pause") != NULL;
+        }
+        count++;
+    }
+
+    fclose(file);
+    return count;
+}
+
+static SDL_Surface* captureFrame(Game* game, const Checkpoint* checkpoint, double* renderMs) {
+    if (checkpoint->pause) Game_pause(game);
+
+    const uint64_t start = timeNowNs();
+    Game_render(game, 1.0f);
+    *renderMs = (double)(timeNowNs() - start) / 1e6;
+
+    if (checkpoint->pause) Game_resume(game);
+    return SDL_ConvertSurfaceFormat(game->render.framebuffer, SDL_PIXELFORMAT_ARGB8888, 0);
+}
+
+static int channelDelta(Uint32 a, Uint32 b, int shift) {
+    const int delta = (int)((a >> shift) & 0xFF) - (int)((b >> shift) & 0xFF);
+    return delta < 0 ? -delta : delta;
+}
+
+static long countDifferences(const SDL_Surface* actual, const SDL_Surface* expected, SDL_Surface* diff,
+                             int threshold) {
+    long differing = 0;
+
+    for (int y = 0; y < actual->h; y++) {
+        const Uint32* a = (const Uint32*)((const Uint8*)actual->pixels + y * actual->pitch);
+        const Uint32* e = (const Uint32*)((const Uint8*)expected->pixels + y * expected->pitch);
+        Uint32* d = (Uint32*)((Uint8*)diff->pixels + y * diff->pitch);
+
+        for (int x = 0; x < actual->w; x++) {
+            int delta = channelDelta(a[x], e[x], 16);
+            const int green = channelDelta(a[x], e[x], 8);
+            const int blue = channelDelta(a[x], e[x], 0);
+            if (green > delta) delta = green;
+            if (blue > delta) delta = blue;
+
+            if (delta > threshold) {
+                differing++;
+                d[x] = 0xFFFF0000u;
+            } else {
+                const Uint32 gray = ((a[x] >> 16 & 0xFF) + (a[x] >> 8 & 0xFF) + (a[x] & 0xFF)) / 12;
+                d[x] = 0xFF000000u | gray << 16 | gray << 8 | gray;
+            }
+        }
+    }
+
+    return differing;
+}
+
+static CompareResult compareFrame(const GoldenOptions* options, const Checkpoint* checkpoint,
+                                  SDL_Surface* actual, double* ratio) {
+    char path[PATH_SIZE];
+    snprintf(path, sizeof(path), "%s/%s.png", options->goldenDir, checkpoint->name);
+
+    if (options->update) {
+        if (IMG_SavePNG(actual, path) != 0) {
+            fprintf(stderr, "Impossible d'ecrire %s : %s\n", path, IMG_GetError());
+            return RESULT_ERROR;
+        }
+        return RESULT_MATCH;
+    }
+
+    SDL_Surface* loaded = IMG_Load(path);
+    if (!loaded) {
+        if (options->outDir) {
+            snprintf(path, sizeof(path), "%s/%s.png", options->outDir, checkpoint->name);
+            IMG_SavePNG(actual, path);
+        }
+        return RESULT_MISSING;
+    }
+    SDL_Surface* expected = SDL_ConvertSurfaceFormat(loaded, SDL_PIXELFORMAT_ARGB8888, 0);
+    SDL_FreeSurface(loaded);
+    if (!expected) return RESULT_ERROR;
+
+    if (expected->w != actual->w || expected->h != actual->h) {
+        fprintf(stderr, "%s : taille %dx%d, reference %dx%d\n", checkpoint->name,
+                actual->w, actual->h, expected->w, expected->h);
+        SDL_FreeSurface(expected);
+        return RESULT_MISMATCH;
+    }
+
+    SDL_Surface* diff = SDL_CreateRGBSurfaceWithFormat(0, actual->w, actual->h, 32, SDL_PIXELFORMAT_ARGB8888);
+    if (!diff) {
+        SDL_FreeSurface(expected);
+        return RESULT_ERROR;
+    }
+
+    const long differing = countDifferences(actual, expected, diff, options->threshold);
+    *ratio = (double)differing / ((double)actual->w * actual->h);
+    const bool match = *ratio <= options->tolerance;
+
+    if (!match && options->outDir) {
+        snprintf(path, sizeof(path), "%s/%s.png", options->outDir, checkpoint->name);
+        IMG_SavePNG(actual, path);
+        snprintf(path, sizeof(path), "%s/%s_diff.png", options->outDir, checkpoint->name);
+        IMG_SavePNG(diff, path);
+    }
+
+    SDL_FreeSurface(diff);
+    SDL_FreeSurface(expected);
+    return match ? RESULT_MATCH : RESULT_MISMATCH;
+}
+
+static bool waitForLoading(Game* game) {
+    const Uint64 start = SDL_GetTicks64();
+    while (game->state == STATE_LOADING && game->running) {
+        if (SDL_GetTicks64() - start > LOADING_TIMEOUT_MS) {
+            fprintf(stderr, "Chargement des assets trop long\n");
+            return false;
+        }
+        Game_update(game);
+        SDL_Delay(1);
+    }
+    return game->state == STATE_MENU;
+}
+
+static bool startReplay(Game* game, const char* path) {
+    if (!Replay_load(&game->replay, path) || game->replay.count == 0) return false;
+
+    game->replayMode = REPLAY_MODE_PLAYBACK;
+    Game_startNewGame(game);
+    return true;
+}
+
+static bool parseOptions(int argc, char* argv[], GoldenOptions* options) {
+    *options = (GoldenOptions){0};
+    options->tolerance = DEFAULT_TOLERANCE;
+    options->threshold = DEFAULT_THRESHOLD;
+
+    for (int i = 1; i < argc; i++) {
+        const bool hasValue = i + 1 < argc;
+
+        if (strcmp(argv[i], "--replay") == 0 && hasValue) {
+            options->replayPath = argv[++i];
+        } else if (strcmp(argv[i], "--checkpoints") == 0 && hasValue) {
+            options->checkpointsPath = argv[++i];
+        } else if (strcmp(argv[i], "--golden") == 0 && hasValue) {
+            options->goldenDir = argv[++i];
+        } else if (strcmp(argv[i], "--out") == 0 && hasValue) {
+            options->outDir = argv[++i];
+        } else if (strcmp(argv[i], "--timings") == 0 && hasValue) {
+            options->timingsPath = argv[++i];
+        } else if (strcmp(argv[i], "--tolerance") == 0 && hasValue) {
+            options->tolerance = strtod(argv[++i], NULL);
+        } else if (strcmp(argv[i], "--threshold") == 0 && hasValue) {
+            options->threshold = (int)strtol(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--simd") == 0 && hasValue) {
+            FramebufferSimd level;
+            if (!Framebuffer_parseSimd(argv[++i], &level)) return false;
+            if (!Framebuffer_setSimd(level)) {
+                fprintf(stderr, "Noyaux %s non supportes par ce processeur\n", Framebuffer_simdName(level));
+                return false;
+            }
+        } else if (strcmp(argv[i], "--update") == 0) {
+            options->update = true;
+        } else {
+            return false;
+        }
+    }
+
+    return options->replayPath && options->checkpointsPath && options->goldenDir &&
+           options->tolerance >= 0.0 && options->threshold >= 0;
+}
+
+int main(int argc, char* argv[]) {
+    GoldenOptions options;
+    if (!parseOptions(argc, argv, &options)) {
+        fprintf(stderr, "Usage : %s --replay FICHIER --checkpoints FICHIER --golden DOSSIER\n"
+                        "       [--out DOSSIER] [--timings FICHIER.csv] [--tolerance 0.001]\n"
+                        "       [--threshold 8] [--simd scalar|sse2|avx2] [--update]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    Checkpoint checkpoints[MAX_CHECKPOINTS] = {0};
+    const int count = loadCheckpoints(options.checkpointsPath, checkpoints);
+    if (count <= 0) return EXIT_FAILURE;
+
+    SDL_setenv("SDL_VIDEODRIVER", "dummy", 0);
+    SDL_setenv("SDL_AUDIODRIVER", "dummy", 0);
+
+    static Game game;
+    game.render.backend = RENDER_BACKEND_SOFTWARE;
+    Game_init(&game);
+    if (!game.running || !waitForLoading(&game)) {
+        Game_destroy(&game);
+        return EXIT_FAILURE;
+    }
+    IMG_Init(IMG_INIT_PNG);
+    printf("rendu logiciel, driver %s, noyaux %s\n", SDL_GetCurrentVideoDriver(), Framebuffer_simdName(Framebuffer_getSimd()));
+
+    FILE* timings = options.timingsPath ? fopen(options.timingsPath, "w") : NULL;
+    if (timings) fprintf(timings, "checkpoint,tick,render_ms,diff_ratio\n");
+
+    int failures = 0;
+    int missing = 0;
+    int tick = -1;
+    bool replayStarted = false;
+
+    for (int c = 0; c < count; c++) {
+        const Checkpoint* checkpoint = &checkpoints[c];
+
+        if (checkpoint->tick != CHECKPOINT_MENU && !replayStarted) {
+            if (!startReplay(&game, options.replayPath)) {
+                failures++;
+                break;
+            }
+            replayStarted = true;
+        }
+
+        while (tick < checkpoint->tick && game.replayMode == REPLAY_MODE_PLAYBACK) {
+            Game_handleInput(&game);
+            Game_update(&game);
+            tick++;
+        }
+        if (checkpoint->tick != CHECKPOINT_MENU && tick < checkpoint->tick) {
+            fprintf(stderr, "%s : replay arrete au tick %d avant le tick %d\n", checkpoint->name, tick,
+                    checkpoint->tick);
+            failures++;
+            break;
+        }
+
+        double renderMs = 0.0;
+        double ratio = 0.0;
+        SDL_Surface* frame = captureFrame(&game, checkpoint, &renderMs);
+        const CompareResult result = frame ? compareFrame(&options, checkpoint, frame, &ratio) : RESULT_ERROR;
+        if (frame) SDL_FreeSurface(frame);
+
+        if (result == RESULT_MISSING) missing++;
+        if (result != RESULT_MATCH) failures++;
+
+        printf("%-18s tick %5d  rendu %7.3f ms  ecart %6.3f%%  %s\n", checkpoint->name, checkpoint->tick,
+               renderMs, ratio * 100.0, options.update ? "reference ecrite" : RESULT_NAMES[result]);
+        if (timings) fprintf(timings, "%s,%d,%.3f,%.6f\n", checkpoint->name, checkpoint->tick, renderMs, ratio);
+    }
+
+    if (timings) fclose(timings);
+    IMG_Quit();
+    Game_destroy(&game);
+
+    if (missing > 0) {
+        printf("%d reference(s) manquante(s) : relancer avec --update pour les generer\n", missing);
+    }
+    return failures > 0 ? EXIT_FAILURE : EXIT_SUCCESS;
+}